@@ -7,9 +7,14 @@
 ../emsdk/emsdk activate latest
 source ../emsdk/emsdk_env.sh
 
-emcc -lembind -s MODULARIZE=1 -s ENVIRONMENT='worker' src/lib/c++/adapter.cpp -o src/lib/c++/cpp.mjs -s ALLOW_MEMORY_GROWTH -s MAXIMUM_MEMORY=1GB -O3
+emcc -lembind -s MODULARIZE=1 -s ENVIRONMENT='worker' src/lib/c++/adapter.cpp -o src/lib/c++/cpp.mjs -s ALLOW_MEMORY_GROWTH -s MAXIMUM_MEMORY=1GB -O3 -std=c++17
 #emcc -lembind -s MODULARIZE=1 -s ENVIRONMENT='worker' src/lib/c++/adapter.cpp -o src/lib/c++/cpp.mjs -s ALLOW_MEMORY_GROWTH -s MAXIMUM_MEMORY=1GB -sASSERTIONS -O3 -sNO_DISABLE_EXCEPTION_CATCHING
 #emcc -lembind -s ENVIRONMENT='worker' src/lib/c++/adapter.cpp -o src/lib/c++/cpp.mjs -s ALLOW_MEMORY_GROWTH -s MAXIMUM_MEMORY=1GB -sASSERTIONS
+# to count the heap allocations, see getAllocationCount()
+#emcc -lembind -s MODULARIZE=1 -s ENVIRONMENT='worker' src/lib/c++/adapter.cpp -o src/lib/c++/cpp.mjs -s ALLOW_MEMORY_GROWTH -s MAXIMUM_MEMORY=1GB -O3 -DCOUNT_ALLOCATIONS
+
+# multi-threaded analysis (see job.cpp), needs the page served with COOP/COEP headers for SharedArrayBuffer
+#emcc -lembind -s MODULARIZE=1 -s ENVIRONMENT='worker' src/lib/c++/adapter.cpp -o src/lib/c++/cpp.mjs -s ALLOW_MEMORY_GROWTH -s MAXIMUM_MEMORY=1GB -O3 -std=c++17 -pthread -sPTHREAD_POOL_SIZE=navigator.hardwareConcurrency -DANALYSIS_THREADS
 
 # hack to solve a bug
 sed -i 's/import.meta.url/self.location.href/g' src/lib/c++/cpp.mjs
@@ -14,27 +14,83 @@
 #include <sstream>
 #include <regex>
 #include <cmath>
-#include <map>
 #include <algorithm>
 #include <vector>
+#include <chrono>
+#ifdef ANALYSIS_THREADS
+#include <atomic>
+#include <thread>
+#endif
 
 //#ifdef __EMSCRIPTEN__
 //#include <emscripten.h>
 #include <emscripten/bind.h>
 
 
+#include "allocations.cpp"
 #include "SGP4.cpp"
 #include "transforms.cpp"
 #include "transforms.hpp"
 #include "solar.cpp"
-#include "solar2.cpp"
+#include "ephemeris.cpp"
+#include "stream.cpp"
+#include "statevector.cpp"
+#include "catalog.cpp"
+#include "arena.cpp"
+#include "pyramid.cpp"
+#include "elements.cpp"
+#include "events.cpp"
+#include "scrub.cpp"
+#include "prefetch.cpp"
+#include "passes.cpp"
+#include "reach.cpp"
+#include "job.cpp"
+#include "results.cpp"
+#include "shadow.cpp"
 
 using namespace emscripten;
 
 std::vector<elsetrec> satrecs;
-std::map<std::string, SatLogItem> satLog;
+std::vector<SatLogItem> satLog; // indexed as satrecs
 std::vector<SatTableRow> satTable;
 std::vector<HistogramItem> histogram;
+std::vector<float> frameBuffer; // see tickFrame()
+size_t frameSize = 0; // floats written in frameBuffer by the last tick
+std::vector<int> viewIndices; // see tickView() and tickLod()
+std::vector<int> elementSelection; // see selectElements()
+
+std::vector<double> stateBuffer; // see tickState()
+size_t stateSize = 0;
+
+const size_t STATE_HEADER_SIZE = 6 /* UTC* entries */ + 2 /* frame, order */;
+const size_t STATE_ENTRIES_BY_SAT = 11;
+
+// Level of detail, see tickLod()
+std::vector<uint32_t> satHashes; // by satellite, stable across init()
+std::vector<uint8_t> lodWatch; // by satellite, overflying when last checked
+uint32_t lodTurn = 0;
+double lodLastJd = 0;
+const int LOD_MAX_LEVEL = 12;
+const double LOD_FULL_CHECK_GAP = 300.0 / 86400.0; // days
+
+// Observers evaluated together by tickObservers()
+std::vector<ObserverFrame> observerFrames;
+std::vector<HistogramItem> observerCounts; // by observer
+std::vector<uint8_t> observerNight; // by observer, for the current tick
+std::vector<uint8_t> observerFlags; // [observer * satrecs.size() + satIndex]
+
+const uint8_t OBSERVER_FLAG_OVERFLY = 1;
+const uint8_t OBSERVER_FLAG_SUNLIT = 2; // sunlit and overfly
+const uint8_t OBSERVER_FLAG_VISIBLE = 4; // sunlit, overfly and night
+TickResults tickResults; // reused by tick()
+
+const size_t FRAME_HEADER_SIZE = 6 /* UTC* entries */ + 2 /* sun lat,lon */;
+const size_t FRAME_ENTRIES_BY_SAT = 4;
+
+// floats of a frame of tickFrame(), an entry by satellite of catalog::selected()
+size_t selectionFrameFloats() {
+    return FRAME_HEADER_SIZE + catalog::selected().size() * FRAME_ENTRIES_BY_SAT;
+}
 
 Observer observer;
 volatile bool isRecording = false;
@@ -104,319 +160,2124 @@ int year, int  mon, int day, int hr, int minute, double sec)
     double jd, jdFrac;
     SGP4Funcs::jday_SGP4(year, mon, day, hr, minute, sec, jd, jdFrac);
 
-    double pos[3];
-    double vel[3];
-    double m;
-    EciV3 pos_v3;
-    V3 vel_v3;
-    PosVel posvel;
+    double pos[3];
+    double vel[3];
+    double m;
+    EciV3 pos_v3;
+    V3 vel_v3;
+    PosVel posvel;
+
+    for(elsetrec& satrec : satrecs) {
+
+        m = (jd - satrec.jdsatepoch) * MINUTES_PER_DAY
+        + (jdFrac - satrec.jdsatepochF) * MINUTES_PER_DAY;
+
+        SGP4Funcs::sgp4(satrec, m, pos, vel);
+
+        pos_v3.x = pos[0];
+        pos_v3.y = pos[1];
+        pos_v3.z = pos[2];
+
+        vel_v3.x = vel[0];
+        vel_v3.y = vel[1];
+        vel_v3.z = vel[2];
+
+        posvel.pos = pos_v3;
+        posvel.vel = vel_v3;
+
+        posvels.push_back(posvel);
+    }
+    return posvels;
+}
+
+
+/**
+ * @brief FNV-1a of the satnum with a final mix, so the low bits are uniform.
+ * Used to pick the same satellites in every tickLod() and after each init().
+ */
+uint32_t satHash(const char* satnum) {
+    uint32_t h = 2166136261u;
+    for(const char* c = satnum; *c; c++) {
+        h = (h ^ (uint8_t) *c) * 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+extern "C" size_t init(std::string tle_string)
+{
+    satrecs.clear();
+    satLog.clear();
+    satTable.clear();
+    arena::clear();
+    histogram.clear();
+    pyramid::clear();
+    ephemeris::clear();
+    observer.defined = false;
+
+    std::stringstream tle_stream;
+    tle_stream.str(tle_string);
+    std::string tle_line;
+
+    // 2 lines TLEs, optionally preceded by the name of the satellite (3LE)
+    catalog::clear();
+    std::string name;
+    std::string line1;
+    std::string line2;
+    while(std::getline(tle_stream, tle_line, '\n')) {
+        if(tle_line.compare(0, 2, "1 ") != 0) {
+            name = tle_line;
+            continue;
+        }
+        line1 = tle_line;
+        if(!std::getline(tle_stream, line2, '\n')) {
+            break;
+        }
+        elsetrec satrec = twoline2satrec(line1, line2);
+        satrecs.push_back(satrec);
+        catalog::add(name);
+        name.clear();
+    }
+
+    frameBuffer.assign(FRAME_HEADER_SIZE + satrecs.size() * FRAME_ENTRIES_BY_SAT, 0);
+    frameSize = 0;
+    tickResults.sats.clear();
+    tickResults.sats.reserve(satrecs.size());
+    viewIndices.clear();
+    viewIndices.reserve(satrecs.size());
+    observerFlags.assign(observerFrames.size() * satrecs.size(), 0);
+
+    satHashes.clear();
+    for(const elsetrec& satrec : satrecs) {
+        satHashes.push_back(satHash(satrec.satnum));
+    }
+    lodWatch.assign(satrecs.size(), 0);
+    lodLastJd = 0;
+    stream::reset(satrecs.size());
+    stateBuffer.assign(STATE_HEADER_SIZE + satrecs.size() * STATE_ENTRIES_BY_SAT, 0);
+    stateSize = 0;
+    elements::build(satrecs);
+    elementSelection.clear();
+    events::reset();
+    scrub::clear();
+    prefetch::stop();
+    job::current.state = job::IDLE;
+    results::catalogHash = results::hash(tle_string);
+    shadow::clear();
+
+    return satrecs.size();
+}
+
+extern "C" void cleanRecords() {
+    isRecording = false;
+    satLog.assign(satrecs.size(), SatLogItem());
+    satTable.clear();
+    arena::clear();
+    histogram.clear();
+    pyramid::clear();
+}
+
+extern "C" void setObserver(Observer observer_) {
+    observer = observer_;
+    observer.defined = true;
+    ephemeris::setObserver(observer);
+    lodLastJd = 0; // the sats to watch have to be checked again
+    events::reset();
+    scrub::clear();
+    prefetch::flush();
+    if(job::current.state == job::RUNNING) {
+        // its records are gone
+        job::current.state = job::CANCELLED;
+    }
+    cleanRecords();
+}
+
+/**
+ * @brief Precomputes the solar ephemeris for [from, to], the following calls
+ * to tick() inside that interval will interpolate the sun from it.
+ * 
+ * @return size_t number of samples, 0 if the interval is empty
+ */
+extern "C" size_t prepareEphemeris(Time from, Time to, double stepSeconds) {
+    double jdFrom, jdFracFrom, jdTo, jdFracTo;
+    SGP4Funcs::jday_SGP4(from.year, from.mon, from.day, from.hr, from.mi, from.sec, jdFrom, jdFracFrom);
+    SGP4Funcs::jday_SGP4(to.year, to.mon, to.day, to.hr, to.mi, to.sec, jdTo, jdFracTo);
+    return ephemeris::prepare(jdFrom, jdFracFrom, jdTo, jdFracTo, stepSeconds, observer);
+}
+
+/**
+ * @brief The next calls to tick() will perform more logic and will update satLog and satTable;
+ * 
+ */
+extern "C" bool startRecording() {
+    if(!observer.defined || isRecording) {
+        return false;
+    }
+    cleanRecords();
+    isRecording = true;
+    return true;
+}
+
+extern "C" void endRecording() {
+    isRecording = false;
+}
+
+/**
+ * @brief Index of satnum in satrecs, -1 if not found
+ */
+int findSatIndex(const std::string& satnum) {
+    for(size_t i = 0; i < satrecs.size(); i++) {
+        if(satnum == satrecs[i].satnum) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// fills the id, the name and the recorded samples of a row of satTable
+void exportRow(SatTableRow& row) {
+    row.id = std::string(satrecs[row.satIndex].satnum) + ":" + std::to_string(row.transit - 1);
+    row.name = catalog::names[row.satIndex];
+    if(row.samplesLength > 0) {
+        arena::copy(row.samplesOffset, row.samplesLength, row.detailed);
+    }
+}
+
+extern "C" std::vector<SatTableRow> getSatTable() {
+    std::vector<SatTableRow> rows = satTable;
+    for(SatTableRow& row : rows) {
+        exportRow(row);
+    }
+    return rows;
+}
+
+extern "C" SatLogItem findSatLog(std::string satnum) {
+    int satIndex = findSatIndex(satnum);
+    if(satIndex < 0 || satIndex >= (int) satLog.size()) {
+        SatLogItem emptySatLogItem;
+        return emptySatLogItem; // check for ->transits, if is empty, then you know
+    }
+    const SatLogItem& satItem = satLog[satIndex];
+    SatLogItem result;
+    result._transitIndex = satItem._transitIndex;
+    result._prevElevation = satItem._prevElevation;
+    result._isRising = satItem._isRising;
+    if(satItem._open.time.empty()) {
+        return result;
+    }
+    result.transits.resize(satItem._transitIndex + 1);
+    for(const SatTableRow& row : satTable) {
+        if(row.satIndex == satIndex) {
+            arena::copy(row.samplesOffset, row.samplesLength, result.transits[row.transit - 1]);
+        }
+    }
+    result.transits[satItem._transitIndex] = satItem._open;
+    return result;
+}
+
+extern "C" std::vector<elsetrec> getSatrecs() {
+    return satrecs;
+}
+
+extern "C" std::vector<HistogramItem> getHistogram() {
+    return histogram;
+}
+
+/**
+ * @brief Only the satellites in some of the groups of mask (catalog::GROUP_*
+ * and user groups) are propagated from now on, the frames only have entries
+ * for them (see getFrameSelection()). Does not change the records.
+ * 
+ * @return uint32_t the previous mask
+ */
+extern "C" uint32_t setGroupMask(uint32_t mask) {
+    uint32_t previous = catalog::mask;
+    catalog::mask = mask;
+    lodLastJd = 0; // the sats to watch have to be checked again
+    return previous;
+}
+
+extern "C" uint32_t getGroupMask() {
+    return catalog::mask;
+}
+
+/**
+ * @brief Adds the user group (8-31) to the satellites whose name starts with
+ * prefix
+ * 
+ * @return size_t the number of satellites tagged
+ */
+extern "C" size_t tagGroup(int group, std::string prefix) {
+    return catalog::tag(group, prefix);
+}
+
+extern "C" void untagGroup(int group) {
+    catalog::untag(group);
+}
+
+/**
+ * @brief Number of satellites in some of the groups of mask
+ */
+extern "C" size_t countGroup(uint32_t mask) {
+    return catalog::count(mask);
+}
+
+extern "C" std::vector<std::string> getSatNames() {
+    return catalog::names;
+}
+
+/**
+ * @brief Selects the satellites whose mean elements are inside the ranges of
+ * query, without propagating. With a user group (8-31) the selection replaces
+ * the satellites of that group, so setGroupMask(1 << group) makes it the
+ * subset of tick() and the analysis.
+ * 
+ * @return size_t the number of satellites selected, see getElementSelection()
+ */
+extern "C" size_t selectElements(ElementQuery query, int group) {
+    double jd, jdFrac;
+    SGP4Funcs::jday_SGP4(query.at.year, query.at.mon, query.at.day,
+        query.at.hr, query.at.mi, query.at.sec, jd, jdFrac);
+    elements::select(query, jd + jdFrac, elementSelection);
+    if(group >= catalog::FIRST_USER_GROUP && group <= catalog::LAST_USER_GROUP) {
+        catalog::untag(group);
+        catalog::tagIndices(group, elementSelection);
+    }
+    return elementSelection.size();
+}
+
+/**
+ * @brief View over the WASM heap of the indexes (in satrecs) of the satellites
+ * of the last selectElements(), ascending
+ */
+extern "C" val getElementSelection() {
+    return val(typed_memory_view(elementSelection.size(), elementSelection.data()));
+}
+
+/**
+ * @brief Changes with the satellites of the frames, so the client only reads
+ * getFrameSelection() again when the mask or the groups changed
+ */
+extern "C" uint32_t getFrameSelectionSerial() {
+    catalog::selected();
+    return catalog::selectionSerial;
+}
+
+/**
+ * @brief View over the WASM heap of the indexes (in satrecs) of the satellites
+ * of the frames of tickFrame(), tickScrub(), tickPrefetched(), tickStream()
+ * and tickState(), in the order of their entries
+ */
+extern "C" val getFrameSelection() {
+    const std::vector<int>& selection = catalog::selected();
+    return val(typed_memory_view(selection.size(), selection.data()));
+}
+
+/**
+ * @brief Radar cross sections (m^2) indexed as satrecs, NaN when unknown,
+ * for the RCS ranges of selectElements()
+ * 
+ * @return size_t the number of satellites with a known RCS
+ */
+extern "C" size_t setRcs(std::vector<double> rcs) {
+    return elements::setRcs(rcs);
+}
+
+/**
+ * @brief Number of heap allocations made so far, always 0 unless compiled
+ * with -DCOUNT_ALLOCATIONS
+ */
+extern "C" size_t getAllocationCount() {
+    return allocations::count.load(std::memory_order_relaxed);
+}
+
+double secondsSinceJ2000(int year, int  mon, int day, int hr, int mi, double sec) {
+    double jd, jdFrac;
+    SGP4Funcs::jday_SGP4(year, mon, day, hr, mi, sec, jd, jdFrac);
+    return ((jd - J2000) + jdFrac) * (MINUTES_PER_DAY * 60);
+}
+
+Time timeSinceJ2000(double seconds) {
+    // the whole seconds are converted at their middle, away from the rounding
+    // of invjday_SGP4 at the minute boundaries (59.9999 s)
+    const double whole = floor(seconds + 1e-6);
+    Time time;
+    SGP4Funcs::invjday_SGP4(J2000, (whole + 0.5) / (MINUTES_PER_DAY * 60),
+        time.year, time.mon, time.day, time.hr, time.mi, time.sec);
+    time.sec = floor(time.sec) + std::max(0.0, seconds - whole);
+    return time;
+}
+
+// shadow::scan() probe of one satellite, the sun from the ephemeris
+struct ShadowProbe {
+    elsetrec& satrec;
+    size_t propagations;
+
+    // eclipse depth (radians), >= 0 only if eclipsed, NAN if SGP4 fails
+    double depth(double t) {
+        propagations++;
+        const double jdFrac = t / (MINUTES_PER_DAY * 60);
+        const double tsince = (J2000 - satrec.jdsatepoch) * MINUTES_PER_DAY
+            + (jdFrac - satrec.jdsatepochF) * MINUTES_PER_DAY;
+        double pos[3];
+        double vel[3];
+        SGP4Funcs::sgp4(satrec, tsince, pos, vel);
+        if(satrec.error != 0) {
+            return NAN;
+        }
+        const double gmst = SGP4Funcs::gstime_SGP4(J2000 + jdFrac);
+        const ephemeris::SunState sun = ephemeris::at(J2000, jdFrac, gmst, observer);
+        const solar::EclipseStatus status = solar::satEclipsed({ pos[0], pos[1], pos[2] }, sun.vector);
+        return status.eclipsed ? status.depth : std::min(status.depth, -1e-12);
+    }
+};
+
+/**
+ * @brief Rebuilds the shadow timeline of every satellite over [t0, t1]
+ * (seconds since J2000), see shadow.cpp
+ *
+ * @return size_t number of eclipses
+ */
+size_t buildShadows(double t0, double t1) {
+    shadow::Timeline& timeline = shadow::timeline;
+    shadow::propagations = 0;
+    timeline.t0 = t0;
+    timeline.t1 = t1;
+    timeline.bounds.clear();
+    timeline.first.assign(satrecs.size() + 1, 0);
+    timeline.covered.assign(satrecs.size(), 0);
+    for(size_t satIndex = 0; satIndex < satrecs.size(); satIndex++) {
+        timeline.first[satIndex] = timeline.bounds.size();
+        ShadowProbe probe = { satrecs[satIndex], 0 };
+        const double depthRate = events::bounds(satrecs[satIndex]).depthRate;
+        timeline.covered[satIndex] = shadow::scan(probe, t0, t1, depthRate, timeline.bounds);
+        shadow::propagations += probe.propagations;
+        if(!timeline.covered[satIndex]) {
+            timeline.bounds.resize(timeline.first[satIndex]);
+        }
+    }
+    timeline.first[satrecs.size()] = timeline.bounds.size();
+    return timeline.bounds.size() / 2;
+}
+
+/**
+ * @brief Fraction of [a, b] (seconds since J2000) in which the satellite is
+ * sunlit, from the shadow timeline if it covers it, otherwise from the
+ * eclipses of [a, b] alone. NAN if SGP4 fails.
+ */
+double sunlitRatio(size_t satIndex, double a, double b) {
+    if(shadow::covers(satIndex, a, b)) {
+        return shadow::sunlitRatio(satIndex, a, b);
+    }
+    // scratch of each thread, see job.cpp
+    static thread_local std::vector<double> eclipses;
+    eclipses.clear();
+    ShadowProbe probe = { satrecs[satIndex], 0 };
+    if(!shadow::scan(probe, a, b, events::bounds(satrecs[satIndex]).depthRate, eclipses)) {
+        return NAN;
+    }
+    return shadow::sunlitRatio(eclipses.data(), eclipses.data() + eclipses.size(), a, b);
+}
+
+/**
+ * @brief Fraction of a recorded transit, from its first to its last sample,
+ * in which the satellite is sunlit, see sunlitRatio(). From the samples if
+ * SGP4 fails.
+ */
+double transitSunlitRatio(size_t satIndex, const Transit& transit) {
+    const Time& a = transit.time.front();
+    const Time& b = transit.time.back();
+    const double ratio = sunlitRatio(satIndex,
+        secondsSinceJ2000(a.year, a.mon, a.day, a.hr, a.mi, a.sec),
+        secondsSinceJ2000(b.year, b.mon, b.day, b.hr, b.mi, b.sec));
+    if(!std::isnan(ratio)) {
+        return ratio;
+    }
+    double sunlit = 0;
+    for(double s : transit.sunlit) {
+        sunlit += s;
+    }
+    return sunlit / transit.sunlit.size();
+}
+
+/**
+ * @brief Propagates every satellite at the given time, updates satLog, satTable
+ * and histogram while recording, and hands each result to
+ * output(satIndex, satrec, tr, posvel), including the ones in error
+ * (tr.errcode != 0, posvel is zero).
+ * 
+ * While not recording, the satellites rejected by filter.propagate(satIndex)
+ * are skipped before the propagation, and while recording the ones rejected
+ * by filter.mayOverfly(satIndex), which must never overfly. The ones rejected by
+ * filter(satIndex, pos_eci) are not converted to geodetic nor sent to output,
+ * and while not recording they are skipped right after the propagation.
+ * 
+ * The observer and recording modes are template parameters so each mode gets
+ * its own loop without their branches, see tickSats().
+ * 
+ * @param begin, end range of satrecs propagated, all of them by default
+ * @param partial while recording, records of a block of satellites for an
+ * analysis thread instead of satTable and the histogram, see job.cpp
+ * @return ephemeris::SunState the sun used for this tick
+ */
+template<bool HasObserver, bool Recording, typename Filter, typename Output>
+ephemeris::SunState tickSatsFor(int year, int  mon, int day, int hr, int mi, double sec,
+    const Filter& filter, Output& output, size_t begin = 0, size_t end = SIZE_MAX,
+    job::Partial* partial = nullptr)
+{
+    double jd, jdFrac;
+    SGP4Funcs::jday_SGP4(year, mon, day, hr, mi, sec, jd, jdFrac);
+    double gmst = SGP4Funcs::gstime_SGP4(jd + jdFrac);
+    const double t = ((jd - J2000) + jdFrac) * (MINUTES_PER_DAY * 60); // see shadow.cpp
+
+    double pos[3];
+    double vel[3];
+    double m;
+    solar::EclipseStatus eclipse_status;
+    EciV3 pos_eci;
+
+    Time time = { year, mon, day, hr, mi, sec };
+
+    ephemeris::SunState sun = ephemeris::at(jd, jdFrac, gmst, observer);
+    solar::V4& solarVector = sun.vector;
+    double sunElevation = sun.elevation;
+    const ObserverFrame frame = observerFrame(observer);
+
+    int overflyCount = 0;
+    int sunlitCount = 0; // only sunlit that overfly
+    int visibleCount = 0;
+
+    end = std::min(end, satrecs.size());
+    for(size_t satIndex = begin; satIndex < end; satIndex++) {
+
+        if(!catalog::active(satIndex)) {
+            continue;
+        }
+        if constexpr (!Recording) {
+            if(!filter.propagate(satIndex)) {
+                continue;
+            }
+        } else {
+            if(!filter.mayOverfly(satIndex)) {
+                continue;
+            }
+        }
+
+        elsetrec& satrec = satrecs[satIndex];
+        TickResult tr;
+
+        m = (jd - satrec.jdsatepoch) * MINUTES_PER_DAY
+        + (jdFrac - satrec.jdsatepochF) * MINUTES_PER_DAY;
+
+        SGP4Funcs::sgp4(satrec, m, pos, vel);
+        if(satrec.error != 0) {
+            tr.errcode = satrec.error;
+            output(satIndex, satrec, tr, PosVel());
+            continue;
+        }
+
+        pos_eci.x = pos[0];
+        pos_eci.y = pos[1];
+        pos_eci.z = pos[2];
+
+        const bool inView = filter(satIndex, pos_eci);
+        if constexpr (!Recording) {
+            if(!inView) {
+                continue;
+            }
+        }
+
+        tr.overfly = false;
+        tr.visible = false;
+
+        // from the shadow timeline if it covers the tick
+        const int lit = shadow::sunlit(satIndex, t);
+        if(lit < 0) {
+            eclipse_status = satEclipsed(pos_eci, solarVector);
+            tr.sunlit = !eclipse_status.eclipsed;
+        } else {
+            tr.sunlit = lit;
+        }
+
+        // has ground observer
+        if constexpr (HasObserver) {
+            
+            EcfV3 pos_ecf = eciToEcf(pos_eci, gmst);
+            LookAngles lookAngles = frameLookAngles(frame, pos_ecf);
+
+            // adding to the satLog if is observable
+            if((lookAngles.elevation * rad2deg) >= observer.minElevation) {
+                
+                tr.overfly = true;
+                tr.visible = tr.sunlit && sunElevation <= -12.0;
+
+                overflyCount++;
+                if(tr.sunlit) {
+                    sunlitCount++;
+                }
+                if(tr.visible) {
+                    visibleCount++;
+                }
+
+                if constexpr (Recording) {
+                    SatLogItem& satItem = satLog[satIndex];
+
+                    const bool isRisingNow = lookAngles.elevation >= satItem._prevElevation;
+                    satItem._prevElevation = lookAngles.elevation;
+                    
+                    Transit& transit = satItem._open;
+                    if(!satItem._isRising && isRisingNow) {
+                        // in this case we send transit and create a new one.
+                        arena::Columns& samples = partial ? partial->samples : arena::samples;
+                        (partial ? partial->satTable : satTable).push_back({
+                            "", // id, built by getSatTable()
+                            "", // name, built by getSatTable()
+                            satItem._transitIndex + 1, // transit
+                            transit.time[0], // starting
+                            transit.time.back(), // ending
+                            transit.elevation[satItem._maxIndex], //maxElevation
+                            transit.azimuth[satItem._maxIndex], // apexAzimuth
+                            Transit(), // detailed, built by getSatTable()
+                            transitSunlitRatio(satIndex, transit), // sunlitRatio
+                            (int) satIndex, // satIndex
+                            arena::append(transit, samples), // samplesOffset
+                            transit.time.size() // samplesLength
+                        });
+                        if(partial) {
+                            partial->closedAt.push_back(partial->step);
+                        }
+                        
+                        satItem._transitIndex++;
+                        // keeps the capacity for the next transit
+                        transit.time.clear();
+                        transit.azimuth.clear();
+                        transit.elevation.clear();
+                        transit.rangeSat.clear();
+                        transit.sunlit.clear();
+                        transit.eclipseDepth.clear();
+                    }
+                    
+                    satItem._isRising = isRisingNow;
+                    if(transit.elevation.empty() || lookAngles.elevation > transit.elevation[satItem._maxIndex]) {
+                        satItem._maxIndex = transit.elevation.size();
+                    }
+                    
+                    if(lit >= 0) {
+                        // only the depth is missing
+                        eclipse_status = satEclipsed(pos_eci, solarVector);
+                    }
+                    transit.time.push_back(time);
+                    transit.azimuth.push_back(lookAngles.azimuth);
+                    transit.elevation.push_back(lookAngles.elevation);
+                    transit.rangeSat.push_back(lookAngles.rangeSat);
+                    transit.sunlit.push_back(tr.sunlit);
+                    transit.eclipseDepth.push_back(eclipse_status.depth / deg2rad);
+                    /*if(d.colorIndex != 11) {
+                        d.colorIndex = eclipse_status.eclipsed ? 10 : 11 / * 10: eclipsed, 11: sinlit * /
+                    }*/
+                }
+                
+            }
+        }
+
+        if(!inView) {
+            continue;
+        }
+
+        auto geodetic = eciToGeodetic(pos_eci, gmst);
+        tr.latitude = radiansToDegrees(geodetic.latitude);
+        tr.longitude = radiansToDegrees(geodetic.longitude);
+        tr.height = geodetic.height / earthRadius;
+
+        PosVel posvel;
+        posvel.pos = pos_eci;
+        posvel.vel = { vel[0], vel[1], vel[2] };
+        output(satIndex, satrec, tr, posvel);
+
+        /*results.push_back({
+            pos_eci,
+            geodetic,
+            lookAngles,
+            eclipse_status
+        });*/
+
+    }
+
+    if constexpr (Recording) {
+        if(partial) {
+            HistogramItem& counts = partial->counts[partial->step - partial->firstStep];
+            counts.overflyCount += overflyCount;
+            counts.sunlitCount += sunlitCount;
+            counts.visibleCount += visibleCount;
+            return sun;
+        }
+        histogram.push_back({
+            time,
+            overflyCount,
+            sunlitCount,
+            visibleCount
+        });
+        pyramid::push((jd - J2000 + jdFrac) * MINUTES_PER_DAY * 60, overflyCount, sunlitCount, visibleCount);
+    }
+
+    return sun;
+}
+
+/**
+ * @brief Reads the observer and recording modes once and runs the matching
+ * tickSatsFor() loop.
+ */
+template<typename Filter, typename Output>
+ephemeris::SunState tickSats(int year, int  mon, int day, int hr, int mi, double sec,
+    const Filter& filter, Output& output)
+{
+    if(!observer.defined) {
+        return tickSatsFor<false, false>(year, mon, day, hr, mi, sec, filter, output);
+    }
+    if(!isRecording) {
+        return tickSatsFor<true, false>(year, mon, day, hr, mi, sec, filter, output);
+    }
+    return tickSatsFor<true, true>(year, mon, day, hr, mi, sec, filter, output);
+}
+
+// tickSats() filter that keeps every satellite
+struct AllSats {
+    bool propagate(size_t satIndex) const {
+        return true;
+    }
+
+    bool mayOverfly(size_t satIndex) const {
+        return true;
+    }
+
+    bool operator()(size_t satIndex, const EciV3& pos) const {
+        return true;
+    }
+};
+
+// tickSats() filter that keeps the satellites inside a ViewCap
+struct CapFilter {
+    EciV3 center; // unit vector in ECI
+    double cosRadius;
+    double maxRadius; // km from the Earth center, farther sats are always kept
+
+    CapFilter(const ViewCap& view, double gmst) {
+        double lat = view.latitude * deg2rad;
+        double lng = view.longitude * deg2rad + gmst;
+        center.x = cos(lat) * cos(lng);
+        center.y = cos(lat) * sin(lng);
+        center.z = sin(lat);
+        cosRadius = view.radius >= 180 ? -1.0 : cos(view.radius * deg2rad);
+        maxRadius = view.maxHeight > 0 ? earthRadius + view.maxHeight : INFINITY;
+    }
+
+    bool propagate(size_t satIndex) const {
+        return true;
+    }
+
+    bool mayOverfly(size_t satIndex) const {
+        return true;
+    }
+
+    bool operator()(size_t satIndex, const EciV3& pos) const {
+        double r = sqrt(pos.x * pos.x + pos.y * pos.y + pos.z * pos.z);
+        if(r > maxRadius) {
+            return true;
+        }
+        return (pos.x * center.x + pos.y * center.y + pos.z * center.z) >= cosRadius * r;
+    }
+};
+
+// tickSats() filter of tickLod(), only propagates the sample of the level,
+// the satellites known to be overflying and a round-robin share of the rest
+struct LodFilter {
+    uint32_t mask; // 2^level - 1
+    uint32_t turn; // round-robin share checked in this tick
+    bool checkAll;
+    bool checkRest; // only with observer, the rest can't become relevant
+
+    bool sampled(size_t satIndex) const {
+        return (satHashes[satIndex] & mask) == 0;
+    }
+
+    bool propagate(size_t satIndex) const {
+        return sampled(satIndex) || (checkRest && (checkAll
+            || lodWatch[satIndex]
+            || ((satHashes[satIndex] >> LOD_MAX_LEVEL) & mask) == turn));
+    }
+
+    bool mayOverfly(size_t satIndex) const {
+        return true;
+    }
+
+    bool operator()(size_t satIndex, const EciV3& pos) const {
+        return true;
+    }
+};
+
+/**
+ * @brief
+ * @note if observer.height = -1000, then we consider that observer = null
+ * @note the results are stored in tickResults, which is reused by the next
+ * call, so it does not allocate once the capacity is reached
+ * 
+ */
+extern "C" const TickResults& tick(int year, int  mon, int day, int hr, int mi, double sec)
+{
+    tickResults.sats.clear();
+    auto output = [](size_t satIndex, const elsetrec& satrec, TickResult& tr, const PosVel& posvel) {
+        if(tr.errcode != 0) {
+            return;
+        }
+        tr.satnum = satrec.satnum; // fits in the small string buffer
+        tickResults.sats.push_back(tr);
+    };
+    ephemeris::SunState sun = tickSats(year, mon, day, hr, mi, sec, AllSats(), output);
+
+    tickResults.sunLat = sun.latitude;
+    tickResults.sunLon = sun.longitude;
+
+    return tickResults;
+
+}
+
+SatTicketStatus satTicketStatus(const TickResult& tr) {
+    if(tr.visible) {
+        return SatTicketStatus::VISIBLE;
+    } else if(tr.sunlit) {
+        return SatTicketStatus::SUNLIT;
+    } else if(tr.overfly) {
+        return SatTicketStatus::OVERFLY;
+    }
+    return SatTicketStatus::NONE;
+}
+
+/**
+ * @brief Writes the header of the frame: UTC time and sun position
+ */
+void writeFrameHeader(int year, int  mon, int day, int hr, int mi, double sec,
+    const ephemeris::SunState& sun)
+{
+    float* header = frameBuffer.data();
+    header[0] = year;
+    header[1] = mon - 1;
+    header[2] = day;
+    header[3] = hr;
+    header[4] = mi;
+    header[5] = sec;
+    header[6] = sun.latitude;
+    header[7] = sun.longitude;
+}
+
+/**
+ * @brief Writes the entries of one satellite in the frame at cursor
+ */
+float* writeFrameSat(float* cursor, const TickResult& tr) {
+    if(tr.errcode != 0) {
+        *cursor++ = -tr.errcode;
+        *cursor++ = 0;
+        *cursor++ = 0;
+        *cursor++ = 0;
+        return cursor;
+    }
+    *cursor++ = (float) satTicketStatus(tr);
+    *cursor++ = tr.latitude;
+    *cursor++ = tr.longitude;
+    *cursor++ = tr.height;
+    return cursor;
+}
+
+/**
+ * @brief Same as tick() but the results are written into frameBuffer with the
+ * layout posted by the worker:
+ * [year, month (0-11), day, hours, minutes, seconds, sunLat, sunLon,
+ *  (status, latitude, longitude, height) x satellite of getFrameSelection()]
+ * The status is a SatTicketStatus or -errcode for the satellites in error.
+ * 
+ * @return size_t the number of floats written, see getFrameBuffer()
+ */
+extern "C" size_t tickFrame(int year, int  mon, int day, int hr, int mi, double sec)
+{
+    float* cursor = frameBuffer.data() + FRAME_HEADER_SIZE;
+    auto output = [&cursor](size_t satIndex, const elsetrec& satrec, const TickResult& tr, const PosVel& posvel) {
+        cursor = writeFrameSat(cursor, tr);
+    };
+    ephemeris::SunState sun = tickSats(year, mon, day, hr, mi, sec, AllSats(), output);
+    writeFrameHeader(year, mon, day, hr, mi, sec, sun);
+
+    frameSize = cursor - frameBuffer.data();
+    return frameSize;
+}
+
+/**
+ * @brief Frame of tickFrame() at the multiple of the scrubbing quantum key,
+ * computed only if it is not in the cache
+ */
+const float* scrubFrame(int64_t key, const float* keep = nullptr) {
+    const float* frame = scrub::find(key);
+    if(frame) {
+        scrub::cache.hits++;
+        return frame;
+    }
+    scrub::cache.misses++;
+    Time time = timeSinceJ2000(key * scrub::cache.quantum);
+    tickFrame(time.year, time.mon, time.day, time.hr, time.mi, time.sec);
+    return scrub::store(key, frameBuffer.data(), keep);
+}
+
+/**
+ * @brief Configures the cache of tickScrub(), clearing it.
+ * 
+ * @param quantumSeconds time between the cached frames
+ * @param maxBytes memory of the cache
+ * @return size_t the number of frames that fit
+ */
+extern "C" size_t setScrubCache(double quantumSeconds, size_t maxBytes) {
+    return scrub::configure(quantumSeconds, maxBytes,
+        selectionFrameFloats());
+}
+
+/**
+ * @brief Same as tickFrame() but served from a ring cache of frames for
+ * scrubbing back and forth, see scrub.cpp: the frames at the multiples of
+ * the quantum around the time are computed once (at most two per call) and
+ * interpolated.
+ * 
+ * @return size_t the number of floats written, see getFrameBuffer()
+ */
+extern "C" size_t tickScrub(int year, int  mon, int day, int hr, int mi, double sec)
+{
+    const size_t frameFloats = selectionFrameFloats();
+    if(scrub::cache.frameFloats != frameFloats) {
+        scrub::configure(scrub::cache.quantum, scrub::cache.maxBytes, frameFloats);
+    }
+    if(scrub::cache.mask != catalog::mask || scrub::cache.revision != catalog::revision) {
+        scrub::clear();
+        scrub::cache.mask = catalog::mask;
+        scrub::cache.revision = catalog::revision;
+    }
+
+    const double q = secondsSinceJ2000(year, mon, day, hr, mi, sec) / scrub::cache.quantum;
+    const int64_t key = (int64_t) floor(q);
+    const double w = q - key;
+
+    const float* a = scrubFrame(key);
+    const float* b = w > 0 ? scrubFrame(key + 1, a) : a;
+    scrub::interpolate(a, b, w, frameBuffer.data(), FRAME_HEADER_SIZE, FRAME_ENTRIES_BY_SAT,
+        catalog::selected().size());
+
+    ephemeris::SunState sun;
+    sun.latitude = frameBuffer[FRAME_HEADER_SIZE - 2];
+    sun.longitude = frameBuffer[FRAME_HEADER_SIZE - 1];
+    writeFrameHeader(year, mon, day, hr, mi, sec, sun);
+
+    frameSize = frameFloats;
+    return frameSize;
+}
+
+/**
+ * @brief Frames of tickScrub() served from the cache and computed
+ */
+extern "C" std::vector<double> getScrubStats() {
+    return { (double) scrub::cache.hits, (double) scrub::cache.misses, (double) scrub::cache.slots.size() };
+}
+
+/**
+ * @brief Starts prefetching the frames of a playback at from, from + step,
+ * from + 2 step... (step < 0 plays backwards), see prefetchFrame() and
+ * tickPrefetched().
+ * 
+ * @param capacity maximum number of frames buffered
+ */
+extern "C" void startPrefetch(Time from, double stepSeconds, size_t capacity) {
+    prefetch::configure(capacity, selectionFrameFloats());
+    prefetch::start(secondsSinceJ2000(from.year, from.mon, from.day, from.hr, from.mi, from.sec), stepSeconds);
+    prefetch::ring.mask = catalog::mask;
+    prefetch::ring.revision = catalog::revision;
+}
+
+extern "C" void stopPrefetch() {
+    prefetch::stop();
+}
+
+// flushes the ring when the catalog mask or revision changes
+void checkPrefetchSelection() {
+    if(prefetch::ring.mask != catalog::mask || prefetch::ring.revision != catalog::revision) {
+        prefetch::flush();
+        prefetch::configure(prefetch::ring.capacity, selectionFrameFloats());
+        prefetch::ring.mask = catalog::mask;
+        prefetch::ring.revision = catalog::revision;
+    }
+}
+
+/**
+ * @brief Computes the next frame of the playback unless depth frames are
+ * already buffered. Meant to be called while the worker is idle.
+ * 
+ * @return size_t the number of frames buffered
+ */
+extern "C" size_t prefetchFrame(size_t depth) {
+    checkPrefetchSelection();
+    if(!prefetch::ring.active || prefetch::full(depth)) {
+        return prefetch::ring.count;
+    }
+    const double t = prefetch::ring.next;
+    Time time = timeSinceJ2000(t);
+    tickFrame(time.year, time.mon, time.day, time.hr, time.mi, time.sec);
+    prefetch::push(t, frameBuffer.data());
+    prefetch::ring.next = t + prefetch::ring.step;
+    return prefetch::ring.count;
+}
+
+/**
+ * @brief Same as tickFrame() but served from the frames of prefetchFrame()
+ * when the time is buffered. Otherwise the frame is computed and the
+ * playback continues from that time.
+ * 
+ * @return size_t the number of floats written, see getFrameBuffer()
+ */
+extern "C" size_t tickPrefetched(int year, int  mon, int day, int hr, int mi, double sec)
+{
+    checkPrefetchSelection();
+    const double t = secondsSinceJ2000(year, mon, day, hr, mi, sec);
+    const float* frame = prefetch::ring.active ? prefetch::find(t) : nullptr;
+    if(!frame) {
+        prefetch::ring.misses++;
+        if(prefetch::ring.active) {
+            prefetch::flush();
+            prefetch::ring.next = t + prefetch::ring.step;
+        }
+        return tickFrame(year, mon, day, hr, mi, sec);
+    }
+    prefetch::ring.hits++;
+    std::copy(frame, frame + prefetch::ring.frameFloats, frameBuffer.data());
+    frameSize = prefetch::ring.frameFloats;
+    return frameSize;
+}
+
+/**
+ * @brief Ticks of tickPrefetched() served from the buffer and computed, and
+ * frames buffered
+ */
+extern "C" std::vector<double> getPrefetchStats() {
+    return { (double) prefetch::ring.hits, (double) prefetch::ring.misses, (double) prefetch::ring.count };
+}
+
+/**
+ * @brief Same as tickFrame() but only the satellites inside the view (and
+ * without errors) are written, in order, and their indexes in satrecs are
+ * written in viewIndices, see getViewIndices().
+ * The culled satellites are neither converted to geodetic nor written.
+ * 
+ * @return size_t the number of floats written, see getFrameBuffer()
+ */
+extern "C" size_t tickView(int year, int  mon, int day, int hr, int mi, double sec, ViewCap view)
+{
+    double jd, jdFrac;
+    SGP4Funcs::jday_SGP4(year, mon, day, hr, mi, sec, jd, jdFrac);
+    CapFilter filter(view, SGP4Funcs::gstime_SGP4(jd + jdFrac));
+
+    viewIndices.clear();
+    float* cursor = frameBuffer.data() + FRAME_HEADER_SIZE;
+    auto output = [&cursor](size_t satIndex, const elsetrec& satrec, const TickResult& tr, const PosVel& posvel) {
+        if(tr.errcode != 0) {
+            return;
+        }
+        cursor = writeFrameSat(cursor, tr);
+        viewIndices.push_back(satIndex);
+    };
+    ephemeris::SunState sun = tickSats(year, mon, day, hr, mi, sec, filter, output);
+    writeFrameHeader(year, mon, day, hr, mi, sec, sun);
+
+    frameSize = cursor - frameBuffer.data();
+    return frameSize;
+}
+
+/**
+ * @brief Same as tickView() but the satellites are decimated instead of culled:
+ * only about 1 / 2^level of them, picked by satHash(), are written. They are
+ * always the same ones, and the ones of a level are included in the lower
+ * levels. The satellites overflying the observer are always written too.
+ * 
+ * The rest of the satellites are not propagated, only a round-robin share of
+ * 1 / 2^level of them is checked in each call, so a satellite that starts to
+ * overfly shows up within 2^level calls. After a jump in time, a change of
+ * observer or when recording, all of them are propagated.
+ * 
+ * @param level 0 writes everything, up to LOD_MAX_LEVEL
+ * @return size_t the number of floats written, see getFrameBuffer()
+ */
+extern "C" size_t tickLod(int year, int  mon, int day, int hr, int mi, double sec, int level)
+{
+    double jd, jdFrac;
+    SGP4Funcs::jday_SGP4(year, mon, day, hr, mi, sec, jd, jdFrac);
+    level = std::max(0, std::min(level, LOD_MAX_LEVEL));
+
+    LodFilter filter;
+    filter.mask = (1u << level) - 1;
+    filter.turn = lodTurn++ & filter.mask;
+    filter.checkAll = fabs((jd + jdFrac) - lodLastJd) > LOD_FULL_CHECK_GAP;
+    filter.checkRest = observer.defined;
+    lodLastJd = jd + jdFrac;
+
+    viewIndices.clear();
+    float* cursor = frameBuffer.data() + FRAME_HEADER_SIZE;
+    auto output = [&cursor, &filter](size_t satIndex, const elsetrec& satrec, const TickResult& tr, const PosVel& posvel) {
+        if(tr.errcode != 0) {
+            return;
+        }
+        lodWatch[satIndex] = tr.overfly;
+        if(!tr.overfly && !filter.sampled(satIndex)) {
+            return;
+        }
+        cursor = writeFrameSat(cursor, tr);
+        viewIndices.push_back(satIndex);
+    };
+    ephemeris::SunState sun = tickSats(year, mon, day, hr, mi, sec, filter, output);
+    writeFrameHeader(year, mon, day, hr, mi, sec, sun);
+
+    frameSize = cursor - frameBuffer.data();
+    return frameSize;
+}
+
+uint8_t streamStatus(const TickResult& tr) {
+    switch(satTicketStatus(tr)) {
+        case SatTicketStatus::VISIBLE:
+            return stream::STATUS_VISIBLE;
+        case SatTicketStatus::SUNLIT:
+            return stream::STATUS_SUNLIT;
+        case SatTicketStatus::OVERFLY:
+            return stream::STATUS_OVERFLY;
+        default:
+            return stream::STATUS_NONE;
+    }
+}
+
+/**
+ * @brief Same as tickFrame() but quantized with the binary format described
+ * in stream.cpp, about 2.3 times smaller than the float frame, and 4 times
+ * with deltas every second.
+ * 
+ * @param delta encode the coordinates as int8 deltas against the previous
+ * tickStream() when smaller, the first frame after init() and one every
+ * stream::KEY_INTERVAL frames are always key frames
+ * @return size_t the size in bytes of the frame, see getStreamBuffer()
+ */
+extern "C" size_t tickStream(int year, int  mon, int day, int hr, int mi, double sec, bool delta)
+{
+    const size_t nSats = catalog::selected().size();
+    if(stream::encoder.selection != catalog::selectionSerial) {
+        stream::reset(nSats);
+        stream::encoder.selection = catalog::selectionSerial;
+    }
+    size_t entry = 0;
+    auto output = [&entry](size_t satIndex, const elsetrec& satrec, const TickResult& tr, const PosVel& posvel) {
+        if(tr.errcode != 0) {
+            stream::writeError(entry++, tr.errcode);
+            return;
+        }
+        stream::writeSat(entry++, streamStatus(tr), tr.latitude, tr.longitude, tr.height);
+    };
+    ephemeris::SunState sun = tickSats(year, mon, day, hr, mi, sec, AllSats(), output);
+    return stream::finish(year, mon, day, hr, mi, sec, sun.latitude, sun.longitude, delta);
+}
+
+/**
+ * @brief View over the WASM heap of the frame written by tickStream()
+ */
+extern "C" val getStreamBuffer() {
+    return val(typed_memory_view(stream::encoder.size, stream::encoder.buffer.data()));
+}
+
+/**
+ * @brief State vectors to animate the satellites in the client between ticks,
+ * written into stateBuffer with the layout:
+ * [year, month (0-11), day, hours, minutes, seconds, frame, order,
+ *  (status, x, y, z, vx, vy, vz, ax, ay, az, horizon) x satellite of
+ *  getFrameSelection()]
+ * in km, km/s, km/s^2 and seconds. Until time + horizon, extrapolating with
+ * the given order (1: p + v t, 2: p + v t + a t^2 / 2) stays under maxError km.
+ * The status is a SatTicketStatus at time, or -errcode (the rest is 0).
+ * 
+ * @param frame statevector::ECI (0) or statevector::ECF (1)
+ * @return size_t the number of doubles written, see getStateBuffer()
+ */
+extern "C" size_t tickState(int year, int  mon, int day, int hr, int mi, double sec,
+    int frame, int order, double maxError)
+{
+    double jd, jdFrac;
+    SGP4Funcs::jday_SGP4(year, mon, day, hr, mi, sec, jd, jdFrac);
+    const double gmst = SGP4Funcs::gstime_SGP4(jd + jdFrac);
+    const statevector::Frame stateFrame = frame == statevector::ECF ? statevector::ECF : statevector::ECI;
+    order = order <= 1 ? 1 : 2;
+
+    double* cursor = stateBuffer.data() + STATE_HEADER_SIZE;
+    auto output = [&](size_t satIndex, const elsetrec& satrec, const TickResult& tr, const PosVel& posvel) {
+        if(tr.errcode != 0) {
+            *cursor++ = -tr.errcode;
+            std::fill(cursor, cursor + STATE_ENTRIES_BY_SAT - 1, 0.0);
+            cursor += STATE_ENTRIES_BY_SAT - 1;
+            return;
+        }
+        const double period = 2 * pi / satrec.no_unkozai * 60.0;
+        statevector::State state = statevector::state(posvel, satrec.mus, period, order, maxError, stateFrame, gmst);
+        *cursor++ = (double) satTicketStatus(tr);
+        *cursor++ = state.pos.x;
+        *cursor++ = state.pos.y;
+        *cursor++ = state.pos.z;
+        *cursor++ = state.vel.x;
+        *cursor++ = state.vel.y;
+        *cursor++ = state.vel.z;
+        *cursor++ = state.acc.x;
+        *cursor++ = state.acc.y;
+        *cursor++ = state.acc.z;
+        *cursor++ = state.horizon;
+    };
+    tickSats(year, mon, day, hr, mi, sec, AllSats(), output);
+
+    double* header = stateBuffer.data();
+    header[0] = year;
+    header[1] = mon - 1;
+    header[2] = day;
+    header[3] = hr;
+    header[4] = mi;
+    header[5] = sec;
+    header[6] = stateFrame;
+    header[7] = order;
+
+    stateSize = cursor - stateBuffer.data();
+    return stateSize;
+}
+
+/**
+ * @brief View over the WASM heap of the state vectors written by tickState()
+ */
+extern "C" val getStateBuffer() {
+    return val(typed_memory_view(stateSize, stateBuffer.data()));
+}
+
+/**
+ * @brief View over the WASM heap of the indexes (in satrecs) of the satellites
+ * written by the last tickView() or tickLod()
+ */
+extern "C" val getViewIndices() {
+    return val(typed_memory_view(viewIndices.size(), viewIndices.data()));
+}
+
+/**
+ * @brief Sets the observers evaluated by tickObservers(), independent of the
+ * observer of tick()
+ * 
+ * @return size_t the number of observers
+ */
+extern "C" size_t setObservers(std::vector<Observer> observers) {
+    observerFrames.clear();
+    for(Observer& observer_ : observers) {
+        observer_.defined = true;
+        observerFrames.push_back(observerFrame(observer_));
+    }
+    observerCounts.assign(observerFrames.size(), HistogramItem());
+    observerNight.assign(observerFrames.size(), 0);
+    observerFlags.assign(observerFrames.size() * satrecs.size(), 0);
+    return observerFrames.size();
+}
+
+/**
+ * @brief Overfly, sunlit and visible status of every satellite for each of
+ * the observers of setObservers(), with a single propagation and ECF rotation
+ * by satellite. The flags (OBSERVER_FLAG_*) are in getObserverFlags().
+ * Nothing is recorded.
+ * 
+ * @return the counts by observer, in the same order of setObservers()
+ */
+extern "C" const std::vector<HistogramItem>& tickObservers(int year, int  mon, int day, int hr, int mi, double sec)
+{
+    double jd, jdFrac;
+    SGP4Funcs::jday_SGP4(year, mon, day, hr, mi, sec, jd, jdFrac);
+    double gmst = SGP4Funcs::gstime_SGP4(jd + jdFrac);
+    ephemeris::SunState sun = ephemeris::at(jd, jdFrac, gmst, observer);
+    const double t = ((jd - J2000) + jdFrac) * (MINUTES_PER_DAY * 60);
+
+    const size_t nObservers = observerFrames.size();
+    const size_t nSats = satrecs.size();
+    Time time = { year, mon, day, hr, mi, sec };
+
+    // night for each observer, see tickSatsFor()
+    for(size_t k = 0; k < nObservers; k++) {
+        observerNight[k] = radiansToDegrees(frameLookAngles(observerFrames[k], sun.ecf).elevation) <= -12.0;
+        observerCounts[k] = { time, 0, 0, 0 };
+    }
+
+    double pos[3];
+    double vel[3];
+    EciV3 pos_eci;
+    for(size_t satIndex = 0; satIndex < nSats; satIndex++) {
+        elsetrec& satrec = satrecs[satIndex];
+        double m = (jd - satrec.jdsatepoch) * MINUTES_PER_DAY
+            + (jdFrac - satrec.jdsatepochF) * MINUTES_PER_DAY;
+
+        if(!catalog::active(satIndex)) {
+            for(size_t k = 0; k < nObservers; k++) {
+                observerFlags[k * nSats + satIndex] = 0;
+            }
+            continue;
+        }
+
+        SGP4Funcs::sgp4(satrec, m, pos, vel);
+        if(satrec.error != 0) {
+            for(size_t k = 0; k < nObservers; k++) {
+                observerFlags[k * nSats + satIndex] = 0;
+            }
+            continue;
+        }
+
+        pos_eci.x = pos[0];
+        pos_eci.y = pos[1];
+        pos_eci.z = pos[2];
+        EcfV3 pos_ecf = eciToEcf(pos_eci, gmst);
+
+        int sunlit = -1; // only computed if any observer sees the sat
+        for(size_t k = 0; k < nObservers; k++) {
+            uint8_t flags = 0;
+            if(frameAboveMinElevation(observerFrames[k], pos_ecf)) {
+                if(sunlit < 0) {
+                    sunlit = shadow::sunlit(satIndex, t);
+                }
+                if(sunlit < 0) {
+                    sunlit = !solar::satEclipsed(pos_eci, sun.vector).eclipsed;
+                }
+                HistogramItem& counts = observerCounts[k];
+                flags = OBSERVER_FLAG_OVERFLY;
+                counts.overflyCount++;
+                if(sunlit) {
+                    flags |= OBSERVER_FLAG_SUNLIT;
+                    counts.sunlitCount++;
+                    if(observerNight[k]) {
+                        flags |= OBSERVER_FLAG_VISIBLE;
+                        counts.visibleCount++;
+                    }
+                }
+            }
+            observerFlags[k * nSats + satIndex] = flags;
+        }
+    }
+
+    return observerCounts;
+}
+
+/**
+ * @brief Flags (OBSERVER_FLAG_*) of every satellite for the observer of
+ * setObserver(), propagating only the satellites with an event that may be
+ * due, see events.cpp. The satellites whose flags changed are in
+ * getEventChanges(). No positions are computed, any other tick gives them.
+ * If the time goes backwards, or the observer or the catalog selection
+ * change, every satellite is evaluated again.
+ * 
+ * @return HistogramItem the counts at that time
+ */
+extern "C" HistogramItem tickEvents(int year, int  mon, int day, int hr, int mi, double sec)
+{
+    events::Scheduler& s = events::scheduler;
+    const size_t nSats = satrecs.size();
+    Time time = { year, mon, day, hr, mi, sec };
+
+    double jd, jdFrac;
+    SGP4Funcs::jday_SGP4(year, mon, day, hr, mi, sec, jd, jdFrac);
+    double gmst = SGP4Funcs::gstime_SGP4(jd + jdFrac);
+
+    ephemeris::SunState sun = ephemeris::at(jd, jdFrac, gmst, observer);
+    const bool night = sun.elevation <= -12.0;
+
+    double t = ((jd - s.jd) + (jdFrac - s.jdFrac)) * MINUTES_PER_DAY * 60;
+    if(!s.ready || t < s.lastT || s.mask != catalog::mask || s.revision != catalog::revision) {
+        events::reset();
+        s.jd = jd;
+        s.jdFrac = jdFrac;
+        s.mask = catalog::mask;
+        s.revision = catalog::revision;
+        s.night = night;
+        s.overflyCount = 0;
+        s.sunlitCount = 0;
+        s.flags.assign(nSats, 0);
+        s.bounds.resize(nSats);
+        for(size_t satIndex = 0; satIndex < nSats; satIndex++) {
+            s.bounds[satIndex] = events::bounds(satrecs[satIndex]);
+            if(observer.defined && catalog::active(satIndex)) {
+                s.queue.push({ 0, (int) satIndex });
+            }
+        }
+        s.ready = true;
+        t = 0;
+    }
+    s.lastT = t;
+    s.changed.clear();
+    s.rescheduled.clear();
+    s.propagations = 0;
+
+    // the twilight changes the visibility of every sunlit satellite that overflies
+    const bool nightChanged = night != s.night;
+    if(nightChanged) {
+        for(size_t satIndex = 0; satIndex < nSats; satIndex++) {
+            if(s.flags[satIndex] & OBSERVER_FLAG_SUNLIT) {
+                s.flags[satIndex] ^= OBSERVER_FLAG_VISIBLE;
+                s.changed.push_back(satIndex);
+            }
+        }
+        s.night = night;
+    }
+
+    const ObserverFrame frame = observerFrame(observer);
+    const double ro = sqrt(frame.ecf.x * frame.ecf.x + frame.ecf.y * frame.ecf.y + frame.ecf.z * frame.ecf.z);
+    const double minElevation = observer.minElevation * deg2rad;
+    double pos[3];
+    double vel[3];
+
+    while(!s.queue.empty() && s.queue.top().t <= t) {
+        const int satIndex = s.queue.top().satIndex;
+        s.queue.pop();
+
+        elsetrec& satrec = satrecs[satIndex];
+        double m = (jd - satrec.jdsatepoch) * MINUTES_PER_DAY
+            + (jdFrac - satrec.jdsatepochF) * MINUTES_PER_DAY;
+        SGP4Funcs::sgp4(satrec, m, pos, vel);
+        s.propagations++;
+
+        uint8_t flags = 0;
+        if(satrec.error == 0) {
+            EciV3 pos_eci = { pos[0], pos[1], pos[2] };
+            EcfV3 pos_ecf = eciToEcf(pos_eci, gmst);
+            LookAngles lookAngles = frameLookAngles(frame, pos_ecf);
+            const bool overfly = (lookAngles.elevation * rad2deg) >= observer.minElevation;
+            double depth = 0;
+            if(overfly) {
+                solar::EclipseStatus eclipse_status = satEclipsed(pos_eci, sun.vector);
+                depth = eclipse_status.depth;
+                flags = OBSERVER_FLAG_OVERFLY;
+                if(!eclipse_status.eclipsed) {
+                    flags |= OBSERVER_FLAG_SUNLIT;
+                    if(night) {
+                        flags |= OBSERVER_FLAG_VISIBLE;
+                    }
+                }
+            }
+            const double r = sqrt(pos_ecf.x * pos_ecf.x + pos_ecf.y * pos_ecf.y + pos_ecf.z * pos_ecf.z);
+            const double cosAngle = (pos_ecf.x * frame.ecf.x + pos_ecf.y * frame.ecf.y + pos_ecf.z * frame.ecf.z) / (r * ro);
+            const double angle = acos(std::max(-1.0, std::min(1.0, cosAngle)));
+            // even when no event can be due, it is checked in the next tick
+            s.rescheduled.push_back({
+                t + events::quietTime(s.bounds[satIndex], angle, overfly, depth, ro, minElevation),
+                satIndex
+            });
+        }
+        // a satellite with an error is not scheduled again until a reset
+
+        const uint8_t previous = s.flags[satIndex];
+        if(flags != previous) {
+            s.overflyCount += (flags & OBSERVER_FLAG_OVERFLY) - (previous & OBSERVER_FLAG_OVERFLY);
+            s.sunlitCount += ((flags & OBSERVER_FLAG_SUNLIT) - (previous & OBSERVER_FLAG_SUNLIT)) / OBSERVER_FLAG_SUNLIT;
+            s.flags[satIndex] = flags;
+            if(!(nightChanged && (previous & OBSERVER_FLAG_SUNLIT))) {
+                s.changed.push_back(satIndex);
+            }
+        }
+    }
+    for(const events::Due& due : s.rescheduled) {
+        s.queue.push(due);
+    }
+
+    return {
+        time,
+        s.overflyCount,
+        s.sunlitCount,
+        night ? s.sunlitCount : 0
+    };
+}
+
+/**
+ * @brief View over the WASM heap of the flags by satellite of tickEvents()
+ */
+extern "C" val getEventFlags() {
+    return val(typed_memory_view(events::scheduler.flags.size(), events::scheduler.flags.data()));
+}
+
+/**
+ * @brief View over the WASM heap of the indexes (in satrecs) of the
+ * satellites whose flags changed in the last tickEvents()
+ */
+extern "C" val getEventChanges() {
+    return val(typed_memory_view(events::scheduler.changed.size(), events::scheduler.changed.data()));
+}
+
+/**
+ * @brief Number of satellites propagated by the last tickEvents()
+ */
+extern "C" size_t getEventPropagations() {
+    return events::scheduler.propagations;
+}
+
+/**
+ * @brief View over the WASM heap of the flags written by tickObservers(),
+ * the flags of the observer k are in [k * nSats, (k + 1) * nSats)
+ */
+extern "C" val getObserverFlags() {
+    return val(typed_memory_view(observerFlags.size(), observerFlags.data()));
+}
+
+// tickSats() filter of the analysis: every satellite that can overfly (see
+// reach.cpp) is recorded but none is converted to geodetic nor output. After
+// each propagation the satellite is skipped until reach::quietTime() says it
+// may overfly again.
+struct RecordOnly {
+    std::vector<double>* next; // seconds since J2000 by satellite
+    const reach::State* reach; // of the observer recorded
+    double t; // seconds since J2000 of the tick
+    double gmst;
+
+    bool propagate(size_t satIndex) const {
+        return true;
+    }
+
+    bool mayOverfly(size_t satIndex) const {
+        return reach::possible(*reach, satIndex) && (*next)[satIndex] <= t;
+    }
+
+    bool operator()(size_t satIndex, const EciV3& pos) const {
+        const elsetrec& satrec = satrecs[satIndex];
+        const double tsince = (J2000 - satrec.jdsatepoch) * MINUTES_PER_DAY
+            + (t / (MINUTES_PER_DAY * 60) - satrec.jdsatepochF) * MINUTES_PER_DAY;
+        (*next)[satIndex] = t + reach::quietTime(*reach, satrec, satIndex, pos, gmst, tsince);
+        return false;
+    }
+};
+
+AnalysisProgress analysisProgress() {
+    const job::Job& job = job::current;
+    return { job.state, (int) job.done, (int) job.total, (int) satTable.size() };
+}
+
+// adds item of the histogram to the pyramid, as tickSatsFor() does
+void pushPyramid(const HistogramItem& item) {
+    double jd, jdFrac;
+    SGP4Funcs::jday_SGP4(item.time.year, item.time.mon, item.time.day, item.time.hr, item.time.mi, item.time.sec, jd, jdFrac);
+    pyramid::push((jd - J2000 + jdFrac) * MINUTES_PER_DAY * 60, item.overflyCount, item.sunlitCount, item.visibleCount);
+}
+
+// key of the job in results.cpp, from everything its records depend on
+uint64_t analysisKey(const job::Job& job, const AnalysisOptions& options) {
+    results::Hasher hasher;
+    hasher.add(results::catalogHash);
+    hasher.add(catalog::groups.data(), catalog::groups.size() * sizeof(uint32_t));
+    hasher.add(job.mask);
+    hasher.add(observer.longitude);
+    hasher.add(observer.latitude);
+    hasher.add(observer.height);
+    hasher.add(observer.minElevation);
+    hasher.add(job.t0);
+    hasher.add(job.step);
+    hasher.add(job.total);
+    hasher.add(options.ephemerisStep);
+    // the rows get sunlit and sunlitRatio from the shadow timeline it covers
+    const uint8_t shadows = !shadow::timeline.first.empty();
+    hasher.add(shadows);
+    hasher.add(shadow::timeline.t0);
+    hasher.add(shadow::timeline.t1);
+    return hasher.h;
+}
+
+/**
+ * @brief Restores the records of a cached job, false if they do not match
+ * the catalog or their samples
+ */
+bool restoreAnalysis(const results::Entry& entry) {
+    const size_t samples = entry.samples.time.size();
+    for(const SatTableRow& row : entry.satTable) {
+        if(row.satIndex < 0 || (size_t) row.satIndex >= satrecs.size()
+            || row.samplesLength > samples || row.samplesOffset > samples - row.samplesLength) {
+            return false;
+        }
+    }
+    satTable = entry.satTable;
+    arena::samples = entry.samples;
+    histogram = entry.histogram;
+    pyramid::clear();
+    for(const HistogramItem& item : histogram) {
+        pushPyramid(item);
+    }
+    return true;
+}
+
+/**
+ * @brief Starts an analysis of observer_ in [from, to] every stepSeconds,
+ * recorded as startRecording(), tick() at each step and endRecording() would,
+ * by the chunks of runAnalysisJob(). Replaces the job in course, the
+ * observer becomes observer_ and the previous records are cleaned.
+ * The satellites that cannot overfly observer_ (see prepareReach()), or not
+ * before a later step (the quiet time of reach.cpp), are not propagated.
+ * If the same analysis is in the cache of results.cpp its records are
+ * restored and the job starts DONE.
+ *
+ * @param options.groupMask catalog groups analyzed, only during the chunks
+ */
+extern "C" AnalysisProgress startAnalysisJob(Observer observer_, Time from, Time to, double stepSeconds,
+    AnalysisOptions options)
+{
+    job::Job& job = job::current;
+    job.state = job::IDLE;
+    job.done = 0;
+    job.total = 0;
+    if(stepSeconds <= 0) {
+        return analysisProgress();
+    }
+    setObserver(observer_);
+    job.mask = options.groupMask != 0 ? options.groupMask : catalog::mask;
+    job.t0 = secondsSinceJ2000(from.year, from.mon, from.day, from.hr, from.mi, from.sec);
+    job.step = stepSeconds;
+    const double t1 = secondsSinceJ2000(to.year, to.mon, to.day, to.hr, to.mi, to.sec);
+    while(job.t0 + job.total * stepSeconds <= t1 + 1e-6) {
+        job.total++;
+    }
+    if(job.total == 0) {
+        // to before from, nothing to record
+        job.state = job::DONE;
+        return analysisProgress();
+    }
+    prepareEphemeris(from, to, options.ephemerisStep);
+    reach::prepare(job.reach, satrecs, observerFrame(observer));
+    job.next.assign(satrecs.size(), -INFINITY);
+    job.partials.clear();
+    job.key = analysisKey(job, options);
+    const results::Entry* entry = results::find(job.key);
+    if(entry && restoreAnalysis(*entry)) {
+        job.done = job.total;
+        job.state = job::DONE;
+        return analysisProgress();
+    }
+    job.state = job::RUNNING;
+#ifdef ANALYSIS_THREADS
+    if(job.threads > 1) {
+        job::pool.start(job.threads);
+    }
+#endif
+    return analysisProgress();
+}
+
+// the serial loop of runAnalysisJob()
+void runAnalysisSteps(double budgetMs) {
+    job::Job& job = job::current;
+    auto output = [](size_t satIndex, const elsetrec& satrec, const TickResult& tr, const PosVel& posvel) {};
+    const auto start = std::chrono::steady_clock::now();
+    while(job.done < job.total) {
+        const double t = job.t0 + job.done * job.step;
+        Time time = timeSinceJ2000(t);
+        const RecordOnly filter = { &job.next, &job.reach, t, SGP4Funcs::gstime_SGP4(J2000 + t / (MINUTES_PER_DAY * 60)) };
+        tickSats(time.year, time.mon, time.day, time.hr, time.mi, time.sec, filter, output);
+        job.done++;
+        if(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() >= budgetMs) {
+            break;
+        }
+    }
+}
 
-    for(elsetrec& satrec : satrecs) {
+#ifdef ANALYSIS_THREADS
+/**
+ * @brief Records the steps [firstStep, firstStep + steps) of the satellites
+ * of the block into its partial, see job.cpp
+ */
+void recordBlock(job::Partial& partial, size_t firstStep, size_t steps) {
+    job::Job& job = job::current;
+    auto output = [](size_t satIndex, const elsetrec& satrec, const TickResult& tr, const PosVel& posvel) {};
+    partial.firstStep = firstStep;
+    partial.counts.assign(steps, HistogramItem());
+    for(size_t k = firstStep; k < firstStep + steps; k++) {
+        const double t = job.t0 + k * job.step;
+        Time time = timeSinceJ2000(t);
+        const RecordOnly filter = { &job.next, &job.reach, t, SGP4Funcs::gstime_SGP4(J2000 + t / (MINUTES_PER_DAY * 60)) };
+        partial.step = k;
+        tickSatsFor<true, true>(time.year, time.mon, time.day, time.hr, time.mi, time.sec, filter, output,
+            partial.begin, partial.end, &partial);
+    }
+}
 
-        m = (jd - satrec.jdsatepoch) * MINUTES_PER_DAY
-        + (jdFrac - satrec.jdsatepochF) * MINUTES_PER_DAY;
+/**
+ * @brief Records the next steps of the job on job.threads threads and merges
+ * them in the order of the serial loop, see job.cpp
+ */
+void runAnalysisRound(size_t steps) {
+    job::Job& job = job::current;
+    const size_t firstStep = job.done;
+    // a few blocks by thread, so a thread with the slow ones does not hold the round
+    const size_t blocks = std::min(satrecs.size(), (size_t) job.threads * job::BLOCKS_BY_THREAD);
+    if(job.partials.size() != blocks) {
+        job.partials.assign(blocks, job::Partial());
+        for(size_t b = 0; b < blocks; b++) {
+            job.partials[b].begin = satrecs.size() * b / blocks;
+            job.partials[b].end = satrecs.size() * (b + 1) / blocks;
+        }
+    }
 
-        SGP4Funcs::sgp4(satrec, m, pos, vel);
+    std::atomic<size_t> nextBlock(0);
+    job::pool.start(job.threads);
+    job::pool.run([&]() {
+        for(size_t b = nextBlock++; b < blocks; b = nextBlock++) {
+            recordBlock(job.partials[b], firstStep, steps);
+        }
+    });
+
+    // by step, the rows of each block in satIndex order, as the serial loop
+    for(size_t k = 0; k < steps; k++) {
+        HistogramItem item;
+        item.time = timeSinceJ2000(job.t0 + (firstStep + k) * job.step);
+        for(job::Partial& partial : job.partials) {
+            for(; partial.merged < partial.satTable.size() && partial.closedAt[partial.merged] == firstStep + k; partial.merged++) {
+                SatTableRow& row = partial.satTable[partial.merged];
+                row.samplesOffset = arena::append(partial.samples, row.samplesOffset, row.samplesLength);
+                satTable.push_back(std::move(row));
+            }
+            item.overflyCount += partial.counts[k].overflyCount;
+            item.sunlitCount += partial.counts[k].sunlitCount;
+            item.visibleCount += partial.counts[k].visibleCount;
+        }
+        histogram.push_back(item);
+        pushPyramid(item);
+    }
+    for(job::Partial& partial : job.partials) {
+        // keeps the capacity for the next round
+        partial.satTable.clear();
+        partial.closedAt.clear();
+        arena::clear(partial.samples);
+        partial.merged = 0;
+    }
+    job.done += steps;
+}
 
-        pos_v3.x = pos[0];
-        pos_v3.y = pos[1];
-        pos_v3.z = pos[2];
+// the rounds of runAnalysisJob(), each one about a quarter of the budget
+void runAnalysisRounds(double budgetMs) {
+    job::Job& job = job::current;
+    const auto start = std::chrono::steady_clock::now();
+    while(job.done < job.total) {
+        const size_t steps = std::min(job.roundSteps, job.total - job.done);
+        const auto roundStart = std::chrono::steady_clock::now();
+        runAnalysisRound(steps);
+        const double roundMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - roundStart).count();
+        const double scale = std::min(4.0, budgetMs / 4 / std::max(roundMs, 1e-3));
+        job.roundSteps = std::max<size_t>(1, std::min<size_t>(job::MAX_ROUND_STEPS, steps * scale));
+        if(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() >= budgetMs) {
+            break;
+        }
+    }
+}
+#endif
 
-        vel_v3.x = vel[0];
-        vel_v3.y = vel[1];
-        vel_v3.z = vel[2];
+/**
+ * @brief Records the next steps of the job until budgetMs is spent (at least
+ * one step while some are left). Finishes the job after its last step.
+ */
+extern "C" AnalysisProgress runAnalysisJob(double budgetMs) {
+    job::Job& job = job::current;
+    if(job.state != job::RUNNING) {
+        return analysisProgress();
+    }
+    const uint32_t previousMask = catalog::mask;
+    catalog::mask = job.mask;
+    isRecording = true;
 
-        posvel.pos = pos_v3;
-        posvel.vel = vel_v3;
+#ifdef ANALYSIS_THREADS
+    if(job.threads > 1 && observer.defined && !satrecs.empty()) {
+        runAnalysisRounds(budgetMs);
+    } else {
+        runAnalysisSteps(budgetMs);
+    }
+#else
+    runAnalysisSteps(budgetMs);
+#endif
 
-        posvels.push_back(posvel);
+    isRecording = false;
+    catalog::mask = previousMask;
+    if(job.done >= job.total) {
+        job.state = job::DONE;
+        job.partials.clear();
+#ifdef ANALYSIS_THREADS
+        job::pool.stop();
+#endif
+        if(results::fits(results::entryBytes(satTable.size(), arena::samples.time.size(), histogram.size()))) {
+            results::Entry entry;
+            entry.key = job.key;
+            entry.satTable = satTable;
+            entry.samples = arena::samples;
+            entry.histogram = histogram;
+            results::store(std::move(entry));
+        }
     }
-    return posvels;
+    return analysisProgress();
 }
 
+/**
+ * @brief Memory of the cache of finished analyses, see results.cpp. The
+ * least recently used ones are evicted to fit.
+ *
+ * @return size_t the analyses cached
+ */
+extern "C" size_t setAnalysisCache(size_t maxBytes) {
+    results::configure(maxBytes);
+    return results::cache.entries.size();
+}
 
-extern "C" size_t init(std::string tle_string)
-{
-    satrecs.clear();
-    satLog.clear();
-    satTable.clear();
-    histogram.clear();
-    observer.defined = false;
-
-    std::stringstream tle_stream;
-    tle_stream.str(tle_string);
-    std::string tle_line;
+extern "C" void clearAnalysisCache() {
+    results::clear();
+}
 
-    std::string line1;
-    std::string line2;
-    bool has_more;
-    do {
-        has_more = (bool) std::getline(tle_stream, line1, '\n');
-        if(has_more) {
-            has_more = (bool) std::getline(tle_stream, line2, '\n');
-            //if(has_more) {
-                elsetrec satrec = twoline2satrec(line1, line2);
-                satrecs.push_back(satrec);
-            //}
-        }
-    } while(has_more);
+/**
+ * @brief Analyses started from the cache and computed, analyses cached and
+ * their bytes
+ */
+extern "C" std::vector<double> getAnalysisCacheStats() {
+    return { (double) results::cache.hits, (double) results::cache.misses,
+        (double) results::cache.entries.size(), (double) results::cache.bytes };
+}
 
-    return satrecs.size();
+/**
+ * @brief Serializes the cache of finished analyses, see results.cpp
+ *
+ * @return size_t bytes, see getAnalysisCacheBlob()
+ */
+extern "C" size_t exportAnalysisCache() {
+    return results::exportBlob();
 }
 
-extern "C" void cleanRecords() {
-    isRecording = false;
-    satLog.clear();
-    satTable.clear();
-    histogram.clear();
+// Returns the blob of the last exportAnalysisCache() (valid until the next one)
+extern "C" val getAnalysisCacheBlob() {
+    return val(typed_memory_view(results::blob.size(), results::blob.data()));
 }
 
-extern "C" void setObserver(Observer observer_) {
-    observer = observer_;
-    observer.defined = true;
-    cleanRecords();
+/**
+ * @brief Adds the analyses of a blob of exportAnalysisCache() to the cache
+ *
+ * @return int analyses added, -1 if the blob is not valid
+ */
+extern "C" int importAnalysisCache(std::string blob) {
+    return results::importBlob((const uint8_t*) blob.data(), blob.size());
 }
 
 /**
- * @brief The next calls to tick() will perform more logic and will update satLog and satTable;
- * 
+ * @brief Stops the job, the records of its steps so far are kept
  */
-extern "C" bool startRecording() {
-    if(!observer.defined || isRecording) {
-        return false;
+extern "C" AnalysisProgress cancelAnalysisJob() {
+    if(job::current.state == job::RUNNING) {
+        job::current.state = job::CANCELLED;
     }
-    cleanRecords();
-    isRecording = true;
-    return true;
+    return analysisProgress();
 }
 
-extern "C" void endRecording() {
-    isRecording = false;
+extern "C" AnalysisProgress getAnalysisProgress() {
+    return analysisProgress();
 }
 
-extern "C" std::vector<SatTableRow> getSatTable() {
-    return satTable;
+/**
+ * @brief Threads of the next chunks of the analysis, the hardware ones if
+ * threads <= 0. Only compiled with -DANALYSIS_THREADS they can be more than
+ * one, see job.cpp. The result is the same with any number of them.
+ *
+ * @return int the threads used
+ */
+extern "C" int setAnalysisThreads(int threads) {
+#ifdef ANALYSIS_THREADS
+    job::current.threads = threads > 0 ? threads : job::defaultThreads();
+#else
+    job::current.threads = 1;
+#endif
+    return job::current.threads;
 }
 
-extern "C" SatLogItem findSatLog(std::string satnum) {
-    if(satLog.count(satnum) == 0) {
-        SatLogItem emptySatLogItem;
-        return emptySatLogItem; // check for ->transits, if is empty, then you know
+/**
+ * @brief Cursor over the rows completed by the job (or the last recording),
+ * at most count from the index from. The rows only grow, so the caller pulls
+ * the new ones with from = the rows already pulled.
+ */
+extern "C" std::vector<SatTableRow> getAnalysisRows(size_t from, size_t count) {
+    std::vector<SatTableRow> rows;
+    if(from >= satTable.size()) {
+        return rows;
+    }
+    const size_t end = from + std::min(count, satTable.size() - from);
+    rows.assign(satTable.begin() + from, satTable.begin() + end);
+    for(SatTableRow& row : rows) {
+        exportRow(row);
     }
-    return satLog[satnum];
+    return rows;
 }
 
-extern "C" std::vector<elsetrec> getSatrecs() {
-    return satrecs;
+/**
+ * @brief Cursor over the histogram, one item by step recorded, see
+ * getAnalysisRows()
+ */
+extern "C" std::vector<HistogramItem> getAnalysisHistogram(size_t from, size_t count) {
+    if(from >= histogram.size()) {
+        return std::vector<HistogramItem>();
+    }
+    const size_t end = from + std::min(count, histogram.size() - from);
+    return std::vector<HistogramItem>(histogram.begin() + from, histogram.begin() + end);
 }
 
-extern "C" std::vector<HistogramItem> getHistogram() {
-    return histogram;
+/**
+ * @brief Buckets of the histogram recorded in [from, to] at the finest
+ * power-of-two resolution with at most pixels of them (plus one at each
+ * side), see pyramid.cpp.
+ *
+ * @return size_t number of buckets, see getHistogramQuery()
+ */
+extern "C" size_t queryHistogram(Time from, Time to, int pixels) {
+    return pyramid::select(
+        secondsSinceJ2000(from.year, from.mon, from.day, from.hr, from.mi, from.sec),
+        secondsSinceJ2000(to.year, to.mon, to.day, to.hr, to.mi, to.sec),
+        pixels
+    );
 }
 
 /**
- * @brief
- * @note if observer.height = -1000, then we consider that observer = null
+ * @brief View over the WASM heap of the buckets of the last queryHistogram():
+ * time (seconds since J2000), then min, max and mean of the overfly, sunlit
+ * and visible counts, 10 doubles by bucket
+ */
+extern "C" val getHistogramQuery() {
+    return val(typed_memory_view(pyramid::query.size(), pyramid::query.data()));
+}
+
+/**
+ * @brief Runs a whole analysis natively, startAnalysisJob() and a single
+ * runAnalysisJob(), without building any frame. The records stay available
+ * as after endRecording().
  * 
+ * @return AnalysisResult the rows of getSatTable() and the histogram
  */
-extern "C" TickResults tick(int year, int  mon, int day, int hr, int mi, double sec)
+extern "C" AnalysisResult analyze(Observer observer_, Time from, Time to, double stepSeconds,
+    AnalysisOptions options)
 {
-    std::vector<TickResult> results;
-
-    double jd, jdFrac;
-    SGP4Funcs::jday_SGP4(year, mon, day, hr, mi, sec, jd, jdFrac);
-    double gmst = SGP4Funcs::gstime_SGP4(jd + jdFrac);
-
-    double pos[3];
-    double vel[3];
-    double m;
-    solar::EclipseStatus eclipse_status;
-    EciV3 pos_eci;
-
-    Time time = { year, mon, day, hr, mi, sec };
-
-    solar::V4 solarVector = solar::calculateSolarPosition(jd + jdFrac);
-    EciV3 sun_pos_eci;
-    sun_pos_eci.x = solarVector.x;
-    sun_pos_eci.y = solarVector.y;
-    sun_pos_eci.z = solarVector.z;
-    auto sun_geodetic = eciToGeodetic(sun_pos_eci, gmst);
-    double sunLat = radiansToDegrees(sun_geodetic.latitude);
-    double sunLon = radiansToDegrees(sun_geodetic.longitude);
-
-    double sunZenith;
-    double sunElevation;
-    if(observer.defined) {
-        EcfV3 sun_pos_ecf = eciToEcf(sun_pos_eci, gmst);
-        LookAngles sunLookAngles = ecfToLookAngles(observer, sun_pos_ecf);
-        sunElevation = radiansToDegrees(sunLookAngles.elevation);
-        sunZenith = solar2::sun_zenith_angle(time, observer.longitude, observer.latitude);
-        //printf("sun:zenith=%f elevation=%f sum=%f \n", sunZenith, sunElevation, sunZenith, sunElevation);
+    AnalysisResult result;
+    if(stepSeconds <= 0) {
+        return result;
     }
+    startAnalysisJob(observer_, from, to, stepSeconds, options);
+    runAnalysisJob(INFINITY);
+    result.satTable = getSatTable();
+    result.histogram = histogram;
+    return result;
+}
 
-    int overflyCount = 0;
-    int sunlitCount = 0; // only sunlit that overfly
-    int visibleCount = 0;
-
-    for(elsetrec& satrec : satrecs) {
-
-        TickResult tr;
-        m = (jd - satrec.jdsatepoch) * MINUTES_PER_DAY
-        + (jdFrac - satrec.jdsatepochF) * MINUTES_PER_DAY;
-
-        SGP4Funcs::sgp4(satrec, m, pos, vel);
+// passes::scan() probe of one satellite seen from an observer
+struct PassProbe {
+    elsetrec& satrec;
+    size_t satIndex;
+    const ObserverFrame& frame;
+    double minElevation; // radians
+    const reach::State& reach; // bands of the observer
+    double pos[3] = {};
+    double vel[3] = {};
+    EciV3 eci = {};
+    EcfV3 ecf = {};
+    double gmst = 0;
+    double tsince = 0; // minutes
+
+    // false if SGP4 fails
+    bool propagate(double t) {
+        passes::propagations++;
+        const double jdFrac = t / (MINUTES_PER_DAY * 60);
+        tsince = (J2000 - satrec.jdsatepoch) * MINUTES_PER_DAY
+            + (jdFrac - satrec.jdsatepochF) * MINUTES_PER_DAY;
+        SGP4Funcs::sgp4(satrec, tsince, pos, vel);
         if(satrec.error != 0) {
-            tr.errcode = satrec.error;
-            continue;
+            return false;
         }
+        gmst = SGP4Funcs::gstime_SGP4(J2000 + jdFrac);
+        eci.x = pos[0];
+        eci.y = pos[1];
+        eci.z = pos[2];
+        ecf = eciToEcf(eci, gmst);
+        return true;
+    }
 
-        pos_eci.x = pos[0];
-        pos_eci.y = pos[1];
-        pos_eci.z = pos[2];
-
-        auto geodetic = eciToGeodetic(pos_eci, gmst);
-        geodetic.latitude = radiansToDegrees(geodetic.latitude);
-        geodetic.longitude = radiansToDegrees(geodetic.longitude);
-        geodetic.height = geodetic.height / earthRadius;
-
-        std::string satnum(satrec.satnum);
-
-        tr.satnum = satnum;
-        tr.latitude = geodetic.latitude;
-        tr.longitude = geodetic.longitude;
-        tr.height = geodetic.height;
-        tr.overfly = false;
-        tr.visible = false;
-
-        eclipse_status = satEclipsed(pos_eci, solarVector);
-        tr.sunlit = !eclipse_status.eclipsed;
-
-        // has ground observer
-        if(observer.defined) {
-            
-            EcfV3 pos_ecf = eciToEcf(pos_eci, gmst);
-            LookAngles lookAngles = ecfToLookAngles(observer, pos_ecf);
-
-            // adding to the satLog if is observable
-            if((lookAngles.elevation * rad2deg) >= observer.minElevation) {
-                
-                tr.overfly = true;
-                tr.visible = tr.sunlit && sunElevation <= -12.0;
+    double elevation(double t) {
+        if(!propagate(t)) {
+            return -pi / 2;
+        }
+        return frameLookAngles(frame, ecf).elevation;
+    }
 
-                overflyCount++;
-                if(tr.sunlit) {
-                    sunlitCount++;
-                }
-                if(tr.visible) {
-                    visibleCount++;
-                }
+    passes::Sample sample(double t) {
+        if(!propagate(t)) {
+            // decayed, nothing until the end
+            return { t, -pi / 2, passes::maxStep };
+        }
+        const double elevation = frameLookAngles(frame, ecf).elevation;
+        const bool overfly = elevation >= minElevation;
+        return { t, elevation, overfly ? 0 : reach::quietTime(reach, satrec, satIndex, eci, gmst, tsince) };
+    }
+};
 
-                if(isRecording) {
-                    // if there is not satnum already in satLog
-                    if(satLog.count(satnum) == 0) {
-                        SatLogItem satItem;
-                        Transit initialTransit;
-                        satItem.transits.push_back(initialTransit);
-                        satItem._transitIndex = 0;
-                        satItem._prevElevation = 0;
-                        satItem._isRising = true;
-                        satLog[satnum] = satItem;
-                    }
+/**
+ * @brief Passes of every satellite over observer_ in [from, to] by root
+ * finding, see passes.cpp, instead of the fixed steps of the recording.
+ * Same rows as getSatTable(), sorted by AOS, with starting, ending and the
+ * culmination to options.tolerance seconds, and the detailed samples every
+ * options.detailStep seconds from AOS to LOS, culmination included.
+ * The sunlitRatio from AOS to LOS is exact, see sunlitRatio().
+ * Nothing is recorded.
+ */
+extern "C" std::vector<SatTableRow> findPasses(Observer observer_, Time from, Time to, PassOptions options)
+{
+    std::vector<SatTableRow> rows;
+    passes::propagations = 0;
+    observer_.defined = true;
+    const double coarseStep = options.coarseStep > 0 ? options.coarseStep : passes::defaultCoarseStep;
+    const double tolerance = options.tolerance > 0 ? options.tolerance : passes::defaultTolerance;
+    const double t0 = secondsSinceJ2000(from.year, from.mon, from.day, from.hr, from.mi, from.sec);
+    const double t1 = secondsSinceJ2000(to.year, to.mon, to.day, to.hr, to.mi, to.sec);
+    if(t1 < t0) {
+        return rows;
+    }
 
-                    SatLogItem& satItem = satLog[satnum];
-                    const double lookAngles_elevation = lookAngles.elevation;
-                    const double satItem_prevElevation = satItem._prevElevation;
-                    const bool isRisingNow = lookAngles.elevation >= satItem._prevElevation;
-                    //printf("%f >= %f =: %s \n", lookAngles_elevation, satItem_prevElevation, (isRisingNow ? "true":"false"));
-                    //printf("%f >= %f := %s \n", lookAngles_elevation, satItem_prevElevation, isRisingNow ? "true":"false");
-                    satItem._prevElevation = lookAngles_elevation;
-                    
-                    if(!satItem._isRising && isRisingNow) {
-                        // in this case we send transit and create a new one.
-                        auto satItemTransit = satItem.transits[satItem._transitIndex];
-                        auto maxElevation = std::max_element(
-                            std::begin(satItemTransit.elevation), 
-                            std::end(satItemTransit.elevation)
-                        );
-                        
-                        int indexMaxElevation = std::distance(
-                            std::begin(satItemTransit.elevation),
-                            maxElevation
-                        );
-
-                        /*SatTableRow newSatTable;
-                        newSatTable.id = std::string(satrec.satnum) + ":" + std::to_string(satItem._transitIndex); // id
-                        newSatTable.transit = satItem._transitIndex + 1; // transit
-                        newSatTable.starting = satItem.transits[satItem._transitIndex].time[0]; // starting
-                        newSatTable.ending = satItem.transits[satItem._transitIndex].time[satItem.transits[satItem._transitIndex].time.size() - 1]; // ending
-                        newSatTable.maxElevation = *maxElevation; //maxElevation
-                        newSatTable.apexAzimuth = satItem.transits[satItem._transitIndex].azimuth[indexMaxElevation]; // apexAzimuth
-                        newSatTable.detailed = satItem.transits[satItem._transitIndex]; // detailed
-                        newSatTable.sunlitRatio = 0.0; // sunlitRatio
-
-                        satTable.push_back(newSatTable);*/
-                        
-                        satTable.push_back({
-                            std::string(satrec.satnum) + ":" + std::to_string(satItem._transitIndex), // id
-                            satItem._transitIndex + 1, // transit
-                            satItem.transits[satItem._transitIndex].time[0], // starting
-                            satItem.transits[satItem._transitIndex].time[satItem.transits[satItem._transitIndex].time.size() - 1], // ending
-                            *maxElevation, //maxElevation
-                            satItem.transits[satItem._transitIndex].azimuth[indexMaxElevation], // apexAzimuth
-                            satItem.transits[satItem._transitIndex], // detailed
-                            0.0 // sunlitRatio
-                        });
-                        
-                        satItem._transitIndex++;
-                        Transit newTransit;
-                        satItem.transits.push_back(newTransit);
-                        
-                    }
-                    
-                    Transit& transit = satItem.transits[satItem._transitIndex];
-                    satItem._isRising = isRisingNow;
-                    
-                    transit.time.push_back(time);
-                    transit.azimuth.push_back(lookAngles.azimuth);
-                    transit.elevation.push_back(lookAngles.elevation);
-                    transit.rangeSat.push_back(lookAngles.rangeSat);
-                    transit.sunlit.push_back(!eclipse_status.eclipsed);
-                    transit.eclipseDepth.push_back(eclipse_status.depth / deg2rad);
-                    /*if(d.colorIndex != 11) {
-                        d.colorIndex = eclipse_status.eclipsed ? 10 : 11 / * 10: eclipsed, 11: sinlit * /
-                    }*/
-                }
-                
+    const ObserverFrame frame = observerFrame(observer_);
+    const double minElevation = observer_.minElevation * deg2rad;
+
+    struct Found {
+        passes::Pass pass;
+        int satIndex;
+        int transit;
+    };
+    std::vector<Found> found;
+    std::vector<passes::Pass> satPasses;
+    // its own bands, the ones of a job in course or prepareReach() stay
+    reach::State reachState;
+    reach::prepare(reachState, satrecs, frame);
+    for(size_t satIndex = 0; satIndex < satrecs.size(); satIndex++) {
+        if(!catalog::active(satIndex) || !reach::possible(reachState, satIndex)) {
+            continue;
+        }
+        PassProbe probe = { satrecs[satIndex], satIndex, frame, minElevation, reachState };
+        satPasses.clear();
+        passes::scan(probe, t0, t1, minElevation, coarseStep, tolerance, satPasses);
+        for(size_t i = 0; i < satPasses.size(); i++) {
+            found.push_back({ satPasses[i], (int) satIndex, (int) i + 1 });
+        }
+    }
+    std::sort(found.begin(), found.end(), [](const Found& a, const Found& b) {
+        return a.pass.aos < b.pass.aos || (a.pass.aos == b.pass.aos && a.satIndex < b.satIndex);
+    });
+
+    rows.reserve(found.size());
+    for(const Found& f : found) {
+        elsetrec& satrec = satrecs[f.satIndex];
+        PassProbe probe = { satrec, (size_t) f.satIndex, frame, minElevation, reachState };
+
+        std::vector<double> times;
+        if(options.detailStep > 0) {
+            for(double t = f.pass.aos; t < f.pass.los; t += options.detailStep) {
+                times.push_back(t);
             }
+        } else {
+            times.push_back(f.pass.aos);
         }
+        times.push_back(f.pass.culmination);
+        times.push_back(f.pass.los);
+        std::sort(times.begin(), times.end());
+        times.erase(std::unique(times.begin(), times.end()), times.end());
+
+        SatTableRow row;
+        row.id = std::string(satrec.satnum) + ":" + std::to_string(f.transit - 1);
+        row.name = catalog::names[f.satIndex];
+        row.transit = f.transit;
+        row.starting = timeSinceJ2000(f.pass.aos);
+        row.ending = timeSinceJ2000(f.pass.los);
+        row.maxElevation = f.pass.maxElevation;
+        row.apexAzimuth = 0;
+        row.sunlitRatio = sunlitRatio(f.satIndex, f.pass.aos, f.pass.los);
+        row.satIndex = f.satIndex;
+        for(double t : times) {
+            if(!probe.propagate(t)) {
+                continue;
+            }
+            LookAngles lookAngles = frameLookAngles(frame, probe.ecf);
+            const double jdFrac = t / (MINUTES_PER_DAY * 60);
+            ephemeris::SunState sun = ephemeris::at(J2000, jdFrac, probe.gmst, observer_);
+            solar::EclipseStatus eclipse_status = satEclipsed(probe.eci, sun.vector);
+            if(t == f.pass.culmination) {
+                row.apexAzimuth = lookAngles.azimuth;
+            }
+            row.detailed.time.push_back(timeSinceJ2000(t));
+            row.detailed.azimuth.push_back(lookAngles.azimuth);
+            row.detailed.elevation.push_back(lookAngles.elevation);
+            row.detailed.rangeSat.push_back(lookAngles.rangeSat);
+            row.detailed.sunlit.push_back(!eclipse_status.eclipsed);
+            row.detailed.eclipseDepth.push_back(eclipse_status.depth / deg2rad);
+        }
+        rows.push_back(row);
+    }
+    return rows;
+}
 
-        results.push_back(tr);
-
-        /*results.push_back({
-            pos_eci,
-            geodetic,
-            lookAngles,
-            eclipse_status
-        });*/
+/**
+ * @brief Latitude bands of the sub-satellite point in which each satellite
+ * can overfly observer_, from its inclination and apogee, see reach.cpp.
+ * analyze() and findPasses() skip the satellites whose band is empty, with
+ * their own bands for their observer.
+ *
+ * @return size_t number of satellites that can overfly, see getReachBands()
+ */
+extern "C" size_t prepareReach(Observer observer_) {
+    observer_.defined = true;
+    return reach::prepare(reach::shared, satrecs, observerFrame(observer_));
+}
 
-    }
+/**
+ * @brief View over the WASM heap of the bands of the last prepareReach():
+ * min, max geocentric latitude (degrees) by satellite, NaN if it cannot
+ * overfly
+ */
+extern "C" val getReachBands() {
+    return val(typed_memory_view(reach::shared.view.size(), reach::shared.view.data()));
+}
 
-    if (isRecording) {
-        histogram.push_back({
-            time,
-            overflyCount,
-            sunlitCount,
-            visibleCount
-        });
-    }
+/**
+ * @brief Shadow entries and exits of every satellite in [from, to] by root
+ * finding, see shadow.cpp. They are the same for every observer: inside
+ * [from, to] the ticks, tickObservers() and the recording look the sunlit
+ * status up instead of evaluating the eclipse, and the recorded rows get
+ * their sunlitRatio from it instead of scanning each one. Uses the solar
+ * ephemeris of prepareEphemeris() when it covers the interval, so prepare it
+ * once for an interval analyzed from several observers.
+ *
+ * @return size_t number of eclipses, see getShadowBounds()
+ */
+extern "C" size_t prepareShadows(Time from, Time to) {
+    return buildShadows(secondsSinceJ2000(from.year, from.mon, from.day, from.hr, from.mi, from.sec),
+        secondsSinceJ2000(to.year, to.mon, to.day, to.hr, to.mi, to.sec));
+}
 
-    TickResults tickResults;
-    tickResults.sats = results;
-    tickResults.sunLat = sunLat;
-    tickResults.sunLon = sunLon;
+/**
+ * @brief View over the WASM heap of the shadow timeline: the bounds of
+ * satellite i are getShadowBounds()[first[i], first[i + 1]), entry and exit
+ * of each eclipse in seconds since J2000 (Infinity if it lasts past the end)
+ */
+extern "C" val getShadowBounds() {
+    return val(typed_memory_view(shadow::timeline.bounds.size(), shadow::timeline.bounds.data()));
+}
 
-    return tickResults;
+// first of getShadowBounds(), one by satellite plus the end
+extern "C" val getShadowFirst() {
+    return val(typed_memory_view(shadow::timeline.first.size(), shadow::timeline.first.data()));
+}
 
+/**
+ * @brief View over the WASM heap of the frame written by tickFrame(), no copy
+ * is made.
+ * @note the view is invalidated when the memory grows, so get it again after
+ * each call to tickFrame() or init()
+ */
+extern "C" val getFrameBuffer() {
+    return val(typed_memory_view(frameSize, frameBuffer.data()));
 }
 
 EMSCRIPTEN_BINDINGS(my_elsetrec)
@@ -657,6 +2518,52 @@ EMSCRIPTEN_BINDINGS(my_elsetrec)
         .field("sunLat", &TickResults::sunLat)
         .field("sunLon", &TickResults::sunLon);
 
+    value_object<ViewCap>("ViewCap")
+        .field("latitude", &ViewCap::latitude)
+        .field("longitude", &ViewCap::longitude)
+        .field("radius", &ViewCap::radius)
+        .field("maxHeight", &ViewCap::maxHeight);
+
+    value_object<ElementQuery>("ElementQuery")
+        .field("inclinationMin", &ElementQuery::inclinationMin)
+        .field("inclinationMax", &ElementQuery::inclinationMax)
+        .field("altitudeMin", &ElementQuery::altitudeMin)
+        .field("altitudeMax", &ElementQuery::altitudeMax)
+        .field("eccentricityMin", &ElementQuery::eccentricityMin)
+        .field("eccentricityMax", &ElementQuery::eccentricityMax)
+        .field("raanMin", &ElementQuery::raanMin)
+        .field("raanMax", &ElementQuery::raanMax)
+        .field("epochAgeMin", &ElementQuery::epochAgeMin)
+        .field("epochAgeMax", &ElementQuery::epochAgeMax)
+        .field("rcsMin", &ElementQuery::rcsMin)
+        .field("rcsMax", &ElementQuery::rcsMax)
+        .field("at", &ElementQuery::at);
+
+    value_object<AnalysisOptions>("AnalysisOptions")
+        .field("ephemerisStep", &AnalysisOptions::ephemerisStep)
+        .field("groupMask", &AnalysisOptions::groupMask);
+
+    value_object<AnalysisProgress>("AnalysisProgress")
+        .field("state", &AnalysisProgress::state)
+        .field("done", &AnalysisProgress::done)
+        .field("total", &AnalysisProgress::total)
+        .field("rows", &AnalysisProgress::rows);
+
+    value_object<PassOptions>("PassOptions")
+        .field("coarseStep", &PassOptions::coarseStep)
+        .field("detailStep", &PassOptions::detailStep)
+        .field("tolerance", &PassOptions::tolerance);
+
+    value_object<AnalysisResult>("AnalysisResult")
+        .field("satTable", &AnalysisResult::satTable)
+        .field("histogram", &AnalysisResult::histogram);
+
+    value_object<Camera>("Camera")
+        .field("latitude", &Camera::latitude)
+        .field("longitude", &Camera::longitude)
+        .field("distance", &Camera::distance)
+        .field("fov", &Camera::fov);
+
     value_object<Time>("Time")
         .field("year", &Time::year)
         .field("mon", &Time::mon)
@@ -682,6 +2589,7 @@ EMSCRIPTEN_BINDINGS(my_elsetrec)
 
     value_object<SatTableRow>("SatTableRow")
         .field("id", &SatTableRow::id)
+        .field("name", &SatTableRow::name)
         .field("transit", &SatTableRow::transit)
         .field("starting", &SatTableRow::starting)
         .field("ending", &SatTableRow::ending)
@@ -721,8 +2629,8 @@ EMSCRIPTEN_BINDINGS(my_elsetrec)
     register_vector<double>("vector<double>");
     register_vector<SatTableRow>("vector<SatTableRow>");
     register_vector<HistogramItem>("vector<HistogramItem>");
-
-    register_map<std::string, SatLogItem>("map<string, SatLogItem>");
+    register_vector<Observer>("vector<Observer>");
+    register_vector<std::string>("vector<string>");
 
     function("twoline2satrec", &twoline2satrec);//, allow_raw_pointers());
     function("predict", &predict);//, allow_raw_pointers());
@@ -734,7 +2642,33 @@ EMSCRIPTEN_BINDINGS(my_elsetrec)
     //function("observe_at", &observe_at);
     //function("at", &at);
     function("tick", &tick);
+    function("tickFrame", &tickFrame);
+    function("getFrameBuffer", &getFrameBuffer);
+    function("tickView", &tickView);
+    function("getViewIndices", &getViewIndices);
+    function("tickLod", &tickLod);
+    function("tickStream", &tickStream);
+    function("getStreamBuffer", &getStreamBuffer);
+    function("tickState", &tickState);
+    function("getStateBuffer", &getStateBuffer);
+    function("cameraViewCap", &cameraViewCap);
+    function("setObservers", &setObservers);
+    function("tickObservers", &tickObservers);
+    function("getObserverFlags", &getObserverFlags);
+    function("tickEvents", &tickEvents);
+    function("setScrubCache", &setScrubCache);
+    function("tickScrub", &tickScrub);
+    function("getScrubStats", &getScrubStats);
+    function("startPrefetch", &startPrefetch);
+    function("stopPrefetch", &stopPrefetch);
+    function("prefetchFrame", &prefetchFrame);
+    function("tickPrefetched", &tickPrefetched);
+    function("getPrefetchStats", &getPrefetchStats);
+    function("getEventFlags", &getEventFlags);
+    function("getEventChanges", &getEventChanges);
+    function("getEventPropagations", &getEventPropagations);
     function("setObserver", &setObserver);
+    function("prepareEphemeris", &prepareEphemeris);
     function("startRecording", &startRecording);
     function("endRecording", &endRecording);
     function("cleanRecords", &cleanRecords);
@@ -749,6 +2683,40 @@ EMSCRIPTEN_BINDINGS(my_elsetrec)
     function("ecfToLookAngles", &ecfToLookAngles);
     function("getSatrecs", &getSatrecs);
     function("getHistogram", &getHistogram);
+    function("getAllocationCount", &getAllocationCount);
+    function("setGroupMask", &setGroupMask);
+    function("getGroupMask", &getGroupMask);
+    function("tagGroup", &tagGroup);
+    function("untagGroup", &untagGroup);
+    function("countGroup", &countGroup);
+    function("getSatNames", &getSatNames);
+    function("selectElements", &selectElements);
+    function("getElementSelection", &getElementSelection);
+    function("getFrameSelectionSerial", &getFrameSelectionSerial);
+    function("getFrameSelection", &getFrameSelection);
+    function("setRcs", &setRcs);
+    function("analyze", &analyze);
+    function("startAnalysisJob", &startAnalysisJob);
+    function("runAnalysisJob", &runAnalysisJob);
+    function("cancelAnalysisJob", &cancelAnalysisJob);
+    function("getAnalysisProgress", &getAnalysisProgress);
+    function("setAnalysisThreads", &setAnalysisThreads);
+    function("setAnalysisCache", &setAnalysisCache);
+    function("clearAnalysisCache", &clearAnalysisCache);
+    function("getAnalysisCacheStats", &getAnalysisCacheStats);
+    function("exportAnalysisCache", &exportAnalysisCache);
+    function("getAnalysisCacheBlob", &getAnalysisCacheBlob);
+    function("importAnalysisCache", &importAnalysisCache);
+    function("prepareShadows", &prepareShadows);
+    function("getShadowBounds", &getShadowBounds);
+    function("getShadowFirst", &getShadowFirst);
+    function("getAnalysisRows", &getAnalysisRows);
+    function("getAnalysisHistogram", &getAnalysisHistogram);
+    function("queryHistogram", &queryHistogram);
+    function("getHistogramQuery", &getHistogramQuery);
+    function("findPasses", &findPasses);
+    function("prepareReach", &prepareReach);
+    function("getReachBands", &getReachBands);
     
 }
 
@@ -0,0 +1,34 @@
+/**
+ * @file allocations.cpp
+ * @brief Heap allocation counter, the global operator new is only replaced
+ * when compiled with -DCOUNT_ALLOCATIONS (see compile.sh).
+ * Used to check that tick() and tickFrame() do not allocate in steady state.
+ */
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace allocations {
+
+std::atomic<size_t> count(0); // the analysis threads allocate too
+
+}
+
+#ifdef COUNT_ALLOCATIONS
+void* operator new(size_t size) {
+    allocations::count.fetch_add(1, std::memory_order_relaxed);
+    void* p = malloc(size ? size : 1);
+    if(!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+#endif
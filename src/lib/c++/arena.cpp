@@ -0,0 +1,96 @@
+/**
+ * @file arena.cpp
+ * @brief Append-only columnar storage of the samples of the recorded
+ * transits, see the recording in tickSatsFor().
+ *
+ * The samples of a transit in course are kept in SatLogItem::_open, whose
+ * vectors are cleared and reused from one transit to the next. When the
+ * transit ends they are appended to the columns here and its row of satTable
+ * only keeps the range (offset, length). The Transit of a row is only built
+ * when it is exported, see getSatTable().
+ */
+#include <cstdint>
+#include <vector>
+#include "transforms.hpp"
+
+namespace arena {
+
+struct Columns {
+    std::vector<Time> time;
+    std::vector<double> azimuth;
+    std::vector<double> elevation;
+    std::vector<double> rangeSat;
+    std::vector<double> sunlit;
+    std::vector<double> eclipseDepth;
+};
+
+Columns samples;
+
+void clear(Columns& columns = samples) {
+    columns.time.clear();
+    columns.azimuth.clear();
+    columns.elevation.clear();
+    columns.rangeSat.clear();
+    columns.sunlit.clear();
+    columns.eclipseDepth.clear();
+}
+
+template<typename T>
+void appendColumn(std::vector<T>& column, const std::vector<T>& values) {
+    column.insert(column.end(), values.begin(), values.end());
+}
+
+/**
+ * @brief Appends the samples of transit to columns
+ *
+ * @return size_t offset of the first one
+ */
+size_t append(const Transit& transit, Columns& columns = samples) {
+    const size_t offset = columns.time.size();
+    appendColumn(columns.time, transit.time);
+    appendColumn(columns.azimuth, transit.azimuth);
+    appendColumn(columns.elevation, transit.elevation);
+    appendColumn(columns.rangeSat, transit.rangeSat);
+    appendColumn(columns.sunlit, transit.sunlit);
+    appendColumn(columns.eclipseDepth, transit.eclipseDepth);
+    return offset;
+}
+
+template<typename T>
+void appendRange(std::vector<T>& column, const std::vector<T>& from, size_t offset, size_t length) {
+    column.insert(column.end(), from.begin() + offset, from.begin() + offset + length);
+}
+
+/**
+ * @brief Appends the samples [offset, offset + length) of other columns
+ * (the partial records of an analysis thread)
+ *
+ * @return size_t offset of the first one
+ */
+size_t append(const Columns& from, size_t offset, size_t length) {
+    const size_t first = samples.time.size();
+    appendRange(samples.time, from.time, offset, length);
+    appendRange(samples.azimuth, from.azimuth, offset, length);
+    appendRange(samples.elevation, from.elevation, offset, length);
+    appendRange(samples.rangeSat, from.rangeSat, offset, length);
+    appendRange(samples.sunlit, from.sunlit, offset, length);
+    appendRange(samples.eclipseDepth, from.eclipseDepth, offset, length);
+    return first;
+}
+
+template<typename T>
+void copyColumn(const std::vector<T>& column, size_t offset, size_t length, std::vector<T>& out) {
+    out.assign(column.begin() + offset, column.begin() + offset + length);
+}
+
+// Transit of the samples [offset, offset + length)
+void copy(size_t offset, size_t length, Transit& out) {
+    copyColumn(samples.time, offset, length, out.time);
+    copyColumn(samples.azimuth, offset, length, out.azimuth);
+    copyColumn(samples.elevation, offset, length, out.elevation);
+    copyColumn(samples.rangeSat, offset, length, out.rangeSat);
+    copyColumn(samples.sunlit, offset, length, out.sunlit);
+    copyColumn(samples.eclipseDepth, offset, length, out.eclipseDepth);
+}
+
+}
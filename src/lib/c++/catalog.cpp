@@ -0,0 +1,173 @@
+/**
+ * @file catalog.cpp
+ * @brief Names and group tags of the satellites, indexed as satrecs.
+ *
+ * Each satellite has a bitmask of groups: the bits 0-7 are the constellation
+ * recognized from its name, the bits 8-31 are user defined groups (tag()).
+ * Only the satellites with a group in the active mask are propagated by
+ * tick() and the analysis, so changing what is analyzed is a setMask() and
+ * not a new init(). The frames of the ticks only have entries for them, in
+ * the order of selected().
+ */
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace catalog {
+
+const uint32_t GROUP_STARLINK = 1 << 0;
+const uint32_t GROUP_ONEWEB = 1 << 1;
+const uint32_t GROUP_IRIDIUM = 1 << 2;
+const uint32_t GROUP_GLOBALSTAR = 1 << 3;
+const uint32_t GROUP_ORBCOMM = 1 << 4;
+const uint32_t GROUP_KUIPER = 1 << 5;
+const uint32_t GROUP_OTHER = 1 << 7; // not in a known constellation
+const int FIRST_USER_GROUP = 8;
+const int LAST_USER_GROUP = 31;
+const uint32_t ALL_GROUPS = 0xFFFFFFFF;
+
+struct Constellation {
+    const char* prefix;
+    uint32_t group;
+};
+
+const Constellation constellations[] = {
+    { "STARLINK", GROUP_STARLINK },
+    { "ONEWEB", GROUP_ONEWEB },
+    { "IRIDIUM", GROUP_IRIDIUM },
+    { "GLOBALSTAR", GROUP_GLOBALSTAR },
+    { "ORBCOMM", GROUP_ORBCOMM },
+    { "KUIPER", GROUP_KUIPER }
+};
+
+std::vector<std::string> names;
+std::vector<uint32_t> groups;
+uint32_t mask = ALL_GROUPS;
+uint32_t revision = 0; // changes with the groups of any satellite
+
+// indexes of the satellites in the mask, ascending, see selected()
+std::vector<int> selection;
+uint32_t selectionMask = 0;
+uint32_t selectionRevision = 0;
+uint32_t selectionSerial = 0; // changes with the selection
+
+bool startsWith(const std::string& text, const std::string& prefix) {
+    return text.compare(0, prefix.size(), prefix) == 0;
+}
+
+/**
+ * @brief Name of a satellite from the title line of a TLE ("0 " of the 3LE
+ * format and surrounding spaces removed)
+ */
+std::string cleanName(std::string name) {
+    if(startsWith(name, "0 ")) {
+        name = name.substr(2);
+    }
+    size_t first = name.find_first_not_of(" \t\r");
+    size_t last = name.find_last_not_of(" \t\r");
+    if(first == std::string::npos) {
+        return "";
+    }
+    return name.substr(first, last - first + 1);
+}
+
+uint32_t constellationGroup(const std::string& name) {
+    for(const Constellation& constellation : constellations) {
+        if(startsWith(name, constellation.prefix)) {
+            return constellation.group;
+        }
+    }
+    return GROUP_OTHER;
+}
+
+void clear() {
+    revision++;
+    names.clear();
+    groups.clear();
+}
+
+void add(const std::string& name) {
+    names.push_back(cleanName(name));
+    groups.push_back(constellationGroup(names.back()));
+}
+
+inline bool active(size_t satIndex) {
+    return (groups[satIndex] & mask) != 0;
+}
+
+/**
+ * @brief Indexes of the satellites in the mask, rebuilt when the mask or the
+ * revision changed since the last call
+ */
+const std::vector<int>& selected() {
+    if(selectionSerial == 0 || selectionMask != mask || selectionRevision != revision) {
+        selection.clear();
+        for(size_t i = 0; i < groups.size(); i++) {
+            if(active(i)) {
+                selection.push_back(i);
+            }
+        }
+        selectionMask = mask;
+        selectionRevision = revision;
+        selectionSerial++;
+    }
+    return selection;
+}
+
+/**
+ * @brief Adds the user group to the satellites whose name starts with prefix
+ *
+ * @return size_t number of satellites tagged, 0 if the group is not a user one
+ */
+size_t tag(int group, const std::string& prefix) {
+    if(group < FIRST_USER_GROUP || group > LAST_USER_GROUP) {
+        return 0;
+    }
+    revision++;
+    size_t count = 0;
+    for(size_t i = 0; i < names.size(); i++) {
+        if(startsWith(names[i], prefix)) {
+            groups[i] |= 1u << group;
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Adds the user group to the satellites of indexes (in satrecs)
+ *
+ * @return size_t number of satellites tagged, 0 if the group is not a user one
+ */
+size_t tagIndices(int group, const std::vector<int>& indexes) {
+    if(group < FIRST_USER_GROUP || group > LAST_USER_GROUP) {
+        return 0;
+    }
+    revision++;
+    for(int satIndex : indexes) {
+        groups[satIndex] |= 1u << group;
+    }
+    return indexes.size();
+}
+
+void untag(int group) {
+    if(group < FIRST_USER_GROUP || group > LAST_USER_GROUP) {
+        return;
+    }
+    revision++;
+    for(uint32_t& satGroups : groups) {
+        satGroups &= ~(1u << group);
+    }
+}
+
+size_t count(uint32_t groupMask) {
+    size_t n = 0;
+    for(uint32_t satGroups : groups) {
+        if(satGroups & groupMask) {
+            n++;
+        }
+    }
+    return n;
+}
+
+}
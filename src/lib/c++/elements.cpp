@@ -0,0 +1,189 @@
+/**
+ * @file elements.cpp
+ * @brief Index of the mean elements of the satellites, see selectElements().
+ *
+ * Every element has its values (indexed as satrecs) and the satellites
+ * sorted by them, so a range is two binary searches. A query walks only the
+ * satellites inside its narrowest range and checks the other ranges on them,
+ * nothing is propagated. The altitude is the mean one, (a - 1) earth radii.
+ *
+ * The TLEs carry no radar cross section, so RCS is unknown (NaN) until it is
+ * given by setRcs(), and a satellite with an unknown value never matches a
+ * bounded range of that element.
+ */
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <vector>
+#include "transforms.hpp"
+
+namespace elements {
+
+enum Key {
+    INCLINATION = 0,
+    ALTITUDE,
+    ECCENTRICITY,
+    RAAN,
+    EPOCH,
+    RCS,
+    N_KEYS
+};
+
+struct Range {
+    double min;
+    double max;
+    bool bounded;
+    bool wraps; // RAAN across 0: [min, 360) and [0, max]
+};
+
+std::vector<double> values[N_KEYS];
+std::vector<int> sorted[N_KEYS]; // sat indexes by value, NaN at the end
+
+const double unknown = std::numeric_limits<double>::quiet_NaN();
+
+void sort(Key key) {
+    const std::vector<double>& v = values[key];
+    std::vector<int>& order = sorted[key];
+    order.resize(v.size());
+    for(size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&v](int a, int b) {
+        return v[a] < v[b] || (!std::isnan(v[a]) && std::isnan(v[b]));
+    });
+}
+
+void build(const std::vector<elsetrec>& satrecs) {
+    const size_t n = satrecs.size();
+    for(int key = 0; key < N_KEYS; key++) {
+        values[key].resize(n);
+    }
+    for(size_t i = 0; i < n; i++) {
+        const elsetrec& satrec = satrecs[i];
+        values[INCLINATION][i] = radiansToDegrees(satrec.inclo);
+        values[ALTITUDE][i] = (satrec.a - 1) * satrec.radiusearthkm;
+        values[ECCENTRICITY][i] = satrec.ecco;
+        values[RAAN][i] = radiansToDegrees(satrec.nodeo);
+        values[EPOCH][i] = satrec.jdsatepoch + satrec.jdsatepochF;
+        values[RCS][i] = unknown;
+    }
+    for(int key = 0; key < N_KEYS; key++) {
+        sort((Key) key);
+    }
+}
+
+/**
+ * @param rcs m^2 indexed as satrecs, NaN (or missing) when unknown
+ * @return size_t number of satellites with a known RCS
+ */
+size_t setRcs(const std::vector<double>& rcs) {
+    std::vector<double>& v = values[RCS];
+    size_t known = 0;
+    for(size_t i = 0; i < v.size(); i++) {
+        v[i] = i < rcs.size() ? rcs[i] : unknown;
+        if(!std::isnan(v[i])) {
+            known++;
+        }
+    }
+    sort(RCS);
+    return known;
+}
+
+Range range(double min, double max) {
+    bool bounded = !(std::isinf(min) && min < 0 && std::isinf(max) && max > 0);
+    return { min, max, bounded, false };
+}
+
+bool inside(const Range& r, double value) {
+    if(r.wraps) {
+        return value >= r.min || value <= r.max;
+    }
+    return value >= r.min && value <= r.max;
+}
+
+// positions in sorted[key] of the values in [min, max]
+std::pair<size_t, size_t> span(Key key, double min, double max) {
+    const std::vector<double>& v = values[key];
+    const std::vector<int>& order = sorted[key];
+    auto first = std::lower_bound(order.begin(), order.end(), min, [&v](int i, double x) {
+        return v[i] < x;
+    });
+    auto last = std::upper_bound(first, order.end(), max, [&v](double x, int i) {
+        return x < v[i] || std::isnan(v[i]);
+    });
+    return { first - order.begin(), last - order.begin() };
+}
+
+/**
+ * @brief Satellites whose elements are inside every bounded range of query
+ *
+ * @param jdAt jd + jdFrac of query.at, reference of the epoch age
+ * @param out indexes in satrecs, ascending
+ */
+void select(const ElementQuery& query, double jdAt, std::vector<int>& out) {
+    out.clear();
+    Range ranges[N_KEYS] = {
+        range(query.inclinationMin, query.inclinationMax),
+        range(query.altitudeMin, query.altitudeMax),
+        range(query.eccentricityMin, query.eccentricityMax),
+        range(query.raanMin, query.raanMax),
+        range(jdAt - query.epochAgeMax, jdAt - query.epochAgeMin),
+        range(query.rcsMin, query.rcsMax)
+    };
+    ranges[RAAN].wraps = ranges[RAAN].bounded && query.raanMin > query.raanMax;
+
+    const size_t n = values[0].size();
+    int driver = -1;
+    size_t driverCount = n;
+    std::pair<size_t, size_t> spans[2];
+    for(int key = 0; key < N_KEYS; key++) {
+        const Range& r = ranges[key];
+        if(!r.bounded) {
+            continue;
+        }
+        std::pair<size_t, size_t> s[2];
+        size_t count;
+        if(r.wraps) {
+            s[0] = span((Key) key, r.min, std::numeric_limits<double>::infinity());
+            s[1] = span((Key) key, -std::numeric_limits<double>::infinity(), r.max);
+            count = (s[0].second - s[0].first) + (s[1].second - s[1].first);
+        } else {
+            s[0] = span((Key) key, r.min, r.max);
+            s[1] = { 0, 0 };
+            count = s[0].second - s[0].first;
+        }
+        if(driver < 0 || count < driverCount) {
+            driver = key;
+            driverCount = count;
+            spans[0] = s[0];
+            spans[1] = s[1];
+        }
+    }
+
+    if(driver < 0) {
+        out.resize(n);
+        for(size_t i = 0; i < n; i++) {
+            out[i] = i;
+        }
+        return;
+    }
+
+    out.reserve(driverCount);
+    for(const std::pair<size_t, size_t>& s : spans) {
+        for(size_t k = s.first; k < s.second; k++) {
+            int satIndex = sorted[driver][k];
+            bool matches = true;
+            for(int key = 0; key < N_KEYS && matches; key++) {
+                if(key != driver && ranges[key].bounded) {
+                    matches = inside(ranges[key], values[key][satIndex]);
+                }
+            }
+            if(matches) {
+                out.push_back(satIndex);
+            }
+        }
+    }
+    std::sort(out.begin(), out.end());
+}
+
+}
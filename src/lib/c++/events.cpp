@@ -0,0 +1,137 @@
+/**
+ * @file events.cpp
+ * @brief Earliest times at which the status of a satellite can change, for
+ * the event driven ticks, see tickEvents().
+ *
+ * The flags of a satellite (OBSERVER_FLAG_*) only change at a horizon
+ * crossing, at a shadow entry or exit while it overflies, or when the
+ * observer crosses the twilight threshold, which is global. After evaluating
+ * a satellite its next check is the earliest time at which one of its events
+ * could happen, from lower bounds of the time to each boundary:
+ *
+ *   horizon  the satellite overflies while the central angle between it and
+ *            the observer is under acos(ro cos(e) / r) - e (e the minimum
+ *            elevation), which is bounded between perigee and apogee. The
+ *            angle changes at most at the orbital angular rate at perigee
+ *            plus the Earth rotation.
+ *   shadow   the eclipse depth of solar::satEclipsed changes at most at the
+ *            same angular rate plus the rate of the Earth semi-diameter due
+ *            to the radial speed, plus the motion of the sun.
+ *
+ * Both use a margin in angle (the elevation is geodetic, the bound
+ * geocentric) and a safety factor for the perturbations of SGP4.
+ */
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <queue>
+#include <functional>
+#include "transforms.hpp"
+
+namespace events {
+
+const double earthRotation = 7.292115146706979e-5; // rad/s
+const double sunRate = 2e-7; // rad/s, apparent motion of the sun, rounded up
+const double angleMargin = 1.0 * deg2rad;
+const double safetyFactor = 0.5;
+const double heightMargin = 50; // km, osculating over the mean perigee/apogee
+
+struct Due {
+    double t; // seconds since the origin of the scheduler
+    int satIndex;
+
+    bool operator>(const Due& other) const {
+        return t > other.t || (t == other.t && satIndex > other.satIndex);
+    }
+};
+
+// per satellite, from its mean elements
+struct Bounds {
+    double perigee;     // km from the Earth center, minus heightMargin
+    double apogee;      // km from the Earth center, plus heightMargin
+    double angularRate; // rad/s, maximum of the sub-satellite point
+    double depthRate;   // rad/s, maximum of the eclipse depth
+};
+
+struct Scheduler {
+    std::priority_queue<Due, std::vector<Due>, std::greater<Due>> queue;
+    std::vector<Bounds> bounds;
+    std::vector<uint8_t> flags; // OBSERVER_FLAG_* by satellite
+    std::vector<int> changed;   // satellites whose flags changed in the last tick
+    std::vector<Due> rescheduled; // scratch of a tick
+    bool ready = false;
+    double jd = 0;       // origin
+    double jdFrac = 0;
+    double lastT = 0;
+    uint32_t mask = 0;   // catalog::mask and catalog::revision at the reset
+    uint32_t revision = 0;
+    bool night = false;
+    int overflyCount = 0;
+    int sunlitCount = 0;
+    size_t propagations = 0; // in the last tick
+};
+
+Scheduler scheduler;
+
+Bounds bounds(const elsetrec& satrec) {
+    Bounds b;
+    const double a = satrec.a * satrec.radiusearthkm;
+    const double e = satrec.ecco;
+    b.perigee = std::max(a * (1 - e) - heightMargin, satrec.radiusearthkm);
+    b.apogee = a * (1 + e) + heightMargin;
+    // h / rp^2, h the specific angular momentum
+    const double h = sqrt(satrec.mus * a * (1 - e * e));
+    b.angularRate = h / (b.perigee * b.perigee) + earthRotation;
+    // d asin(R / r) / dt = R r' / (r sqrt(r^2 - R^2)), r' <= e sqrt(mu / p)
+    const double p = a * (1 - e * e);
+    const double radialSpeed = e * sqrt(satrec.mus / p);
+    const double R = solar::xkmper;
+    const double rp = std::max(b.perigee, R * 1.001);
+    b.depthRate = h / (b.perigee * b.perigee) + sunRate
+        + R * radialSpeed / (rp * sqrt(rp * rp - R * R));
+    return b;
+}
+
+/**
+ * @brief Central angle of the overfly cap of a satellite at radius r
+ *
+ * @param ro geocentric radius of the observer, km
+ * @param minElevation radians
+ */
+double capAngle(double r, double ro, double minElevation) {
+    double c = ro * cos(minElevation) / r;
+    if(c >= 1) {
+        return 0;
+    }
+    return std::max(0.0, acos(c) - minElevation);
+}
+
+/**
+ * @brief Seconds from the evaluation during which the flags of the satellite
+ * cannot change (the twilight apart)
+ *
+ * @param angle central angle between the satellite and the observer, radians
+ * @param overfly the satellite is over the minimum elevation
+ * @param depth eclipse depth, radians, only used if overfly
+ */
+double quietTime(const Bounds& b, double angle, bool overfly, double depth,
+    double ro, double minElevation)
+{
+    if(!overfly) {
+        // until it can enter the widest cap
+        double distance = angle - capAngle(b.apogee, ro, minElevation) - angleMargin;
+        return std::max(0.0, safetyFactor * distance / b.angularRate);
+    }
+    // until it can leave the narrowest cap or cross the shadow boundary
+    double exit = capAngle(b.perigee, ro, minElevation) - angle - angleMargin;
+    double shadow = fabs(depth) - angleMargin;
+    return std::max(0.0, safetyFactor * std::min(exit / b.angularRate, shadow / b.depthRate));
+}
+
+void reset() {
+    scheduler.queue = decltype(scheduler.queue)();
+    scheduler.changed.clear();
+    scheduler.ready = false;
+}
+
+}
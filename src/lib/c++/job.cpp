@@ -0,0 +1,160 @@
+/**
+ * @file job.cpp
+ * @brief State of the analysis run in chunks, see startAnalysisJob().
+ *
+ * The job is the loop of analyze() split by time steps: each
+ * runAnalysisJob() records the steps that fit in a time budget and returns,
+ * so the worker can serve ticks, report the progress and pull the rows
+ * completed so far (satTable only grows while recording) between chunks. The
+ * recording and the group mask of the job are only in place during a chunk,
+ * a tick() between chunks is not recorded. A new observer cancels the job.
+ *
+ * Compiled with -DANALYSIS_THREADS (see compile.sh) a chunk records rounds of
+ * steps on several threads. The satellites are split in contiguous blocks
+ * that the threads take in turn, each block records its steps in its own
+ * Partial: the rows closed, their samples and the counts by step. Between
+ * rounds the partials are merged step by step and block by block, so
+ * satTable, the samples and the histogram come in the order of the serial
+ * loop and the result is identical whatever the number of threads. The
+ * threads only share read-only state and the entries of their own
+ * satellites (satLog, next). They are started once by startAnalysisJob()
+ * (a Pool), which the rounds wake up, and stopped when the job is done.
+ */
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#ifdef ANALYSIS_THREADS
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#endif
+#include "transforms.hpp"
+
+namespace job {
+
+enum State : int {
+    IDLE = 0,
+    RUNNING = 1,
+    DONE = 2,
+    CANCELLED = 3
+};
+
+const size_t BLOCKS_BY_THREAD = 4;
+const size_t MAX_ROUND_STEPS = 1024; // bounds the rows kept in the partials
+
+// records of a block of satellites during a round, see tickSatsFor()
+struct Partial {
+    size_t begin = 0, end = 0; // satrecs of the block
+    size_t firstStep = 0; // first step of the round
+    size_t step = 0; // step in course
+    std::vector<SatTableRow> satTable; // samplesOffset in samples
+    arena::Columns samples;
+    std::vector<size_t> closedAt; // step by row of satTable
+    std::vector<HistogramItem> counts; // by step of the round
+    size_t merged = 0; // rows of satTable merged
+};
+
+// the hardware threads when compiled with -DANALYSIS_THREADS, otherwise 1
+int defaultThreads() {
+#ifdef ANALYSIS_THREADS
+    return std::max(1, (int) std::thread::hardware_concurrency());
+#else
+    return 1;
+#endif
+}
+
+struct Job {
+    State state = IDLE;
+    double t0 = 0; // seconds since J2000
+    double step = 0; // seconds
+    size_t total = 0; // time steps
+    size_t done = 0;
+    uint32_t mask = 0; // catalog::mask of the job
+    uint64_t key = 0; // of its records in results.cpp
+    std::vector<double> next; // seconds since J2000 by satellite, see RecordOnly
+    reach::State reach; // of the observer of the job, see RecordOnly
+    int threads = defaultThreads(); // see setAnalysisThreads()
+    size_t roundSteps = 16; // steps by round of the threads, adapted to the budget
+    std::vector<Partial> partials; // by block
+};
+
+Job current;
+
+#ifdef ANALYSIS_THREADS
+// threads waiting for the rounds of the job, see runAnalysisRound()
+struct Pool {
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake; // a round or stopping
+    std::condition_variable idle; // the round is done
+    std::function<void()> work; // of the round in course
+    uint64_t round = 0;
+    size_t busy = 0; // threads still in the round
+    bool stopping = false;
+
+    // seen: the last round before the thread started
+    void loop(uint64_t seen) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true) {
+            wake.wait(lock, [&]() { return stopping || round != seen; });
+            if(stopping) {
+                return;
+            }
+            seen = round;
+            lock.unlock();
+            work();
+            lock.lock();
+            if(--busy == 0) {
+                idle.notify_one();
+            }
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for(std::thread& thread : threads) {
+            thread.join();
+        }
+        threads.clear();
+        stopping = false;
+    }
+
+    // the calling thread plus n - 1 of the pool, started unless they are
+    void start(int n) {
+        if(threads.size() == (size_t) std::max(0, n - 1)) {
+            return;
+        }
+        stop();
+        for(int i = 1; i < n; i++) {
+            threads.emplace_back([this, seen = round]() { loop(seen); });
+        }
+    }
+
+    // runs f on every thread of the pool and the calling one, until all return
+    void run(const std::function<void()>& f) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            work = f;
+            busy = threads.size();
+            round++;
+        }
+        wake.notify_all();
+        f();
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [&]() { return busy == 0; });
+    }
+
+    ~Pool() {
+        stop();
+    }
+};
+
+Pool pool;
+#endif
+
+}
@@ -0,0 +1,259 @@
+/**
+ * @file passes.cpp
+ * @brief Pass prediction by root finding, see findPasses().
+ *
+ * The elevation of a satellite is sampled with a coarse step, longer while it
+ * is far from the observer (the quiet time of events.cpp, in which it cannot
+ * overfly). The horizon crossings bracketed by two samples are refined with
+ * Brent's method into AOS and LOS, and every local maximum of the samples
+ * (a < b > c) with Brent's minimization into the culmination, which also
+ * finds the passes shorter than the step, whose samples are all under the
+ * minimum elevation.
+ *
+ * The times are seconds since J2000.
+ */
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include "transforms.hpp"
+
+namespace passes {
+
+const double defaultCoarseStep = 60; // seconds
+const double defaultTolerance = 0.1; // seconds
+const double maxStep = 3600; // seconds
+const int maxIterations = 100;
+const double golden = 0.3819660112501051; // (3 - sqrt(5)) / 2
+
+struct Pass {
+    double aos;
+    double los;
+    double culmination;
+    double maxElevation; // radians
+};
+
+struct Sample {
+    double t;
+    double elevation; // radians
+    double quietTime; // seconds, only of the coarse samples
+};
+
+size_t propagations = 0; // by the last findPasses()
+
+/**
+ * @brief Root of f in [a, b], with f(a) and f(b) of different sign (Brent)
+ */
+template<typename F>
+double brentRoot(F& f, double a, double b, double fa, double fb, double tolerance) {
+    double c = a, fc = fa;
+    double d = b - a, e = d;
+    for(int i = 0; i < maxIterations; i++) {
+        if((fb > 0) == (fc > 0)) {
+            c = a;
+            fc = fa;
+            d = e = b - a;
+        }
+        if(fabs(fc) < fabs(fb)) {
+            a = b; b = c; c = a;
+            fa = fb; fb = fc; fc = fa;
+        }
+        const double tol = 2e-12 * fabs(b) + 0.5 * tolerance;
+        const double m = 0.5 * (c - b);
+        if(fabs(m) <= tol || fb == 0) {
+            return b;
+        }
+        if(fabs(e) >= tol && fabs(fa) > fabs(fb)) {
+            // secant or inverse quadratic interpolation
+            double p, q, r;
+            const double s = fb / fa;
+            if(a == c) {
+                p = 2 * m * s;
+                q = 1 - s;
+            } else {
+                q = fa / fc;
+                r = fb / fc;
+                p = s * (2 * m * q * (q - r) - (b - a) * (r - 1));
+                q = (q - 1) * (r - 1) * (s - 1);
+            }
+            if(p > 0) {
+                q = -q;
+            } else {
+                p = -p;
+            }
+            if(2 * p < std::min(3 * m * q - fabs(tol * q), fabs(e * q))) {
+                e = d;
+                d = p / q;
+            } else {
+                d = m;
+                e = m;
+            }
+        } else {
+            d = m;
+            e = m;
+        }
+        a = b;
+        fa = fb;
+        b += fabs(d) > tol ? d : (m > 0 ? tol : -tol);
+        fb = f(b);
+    }
+    return b;
+}
+
+/**
+ * @brief Maximum of f in [a, b] (Brent's minimization of -f)
+ *
+ * @return Sample the time and the value of the maximum
+ */
+template<typename F>
+Sample brentMax(F& f, double a, double b, double tolerance) {
+    double x = a + golden * (b - a);
+    double w = x, v = x;
+    double fx = -f(x);
+    double fw = fx, fv = fx;
+    double d = 0, e = 0;
+    for(int i = 0; i < maxIterations; i++) {
+        const double m = 0.5 * (a + b);
+        const double tol = 2e-12 * fabs(x) + 0.5 * tolerance;
+        if(fabs(x - m) <= 2 * tol - 0.5 * (b - a)) {
+            break;
+        }
+        bool parabolic = false;
+        if(fabs(e) > tol) {
+            double r = (x - w) * (fx - fv);
+            double q = (x - v) * (fx - fw);
+            double p = (x - v) * q - (x - w) * r;
+            q = 2 * (q - r);
+            if(q > 0) {
+                p = -p;
+            } else {
+                q = -q;
+            }
+            if(fabs(p) < fabs(0.5 * q * e) && p > q * (a - x) && p < q * (b - x)) {
+                e = d;
+                d = p / q;
+                parabolic = true;
+                if((x + d) - a < 2 * tol || b - (x + d) < 2 * tol) {
+                    d = x < m ? tol : -tol;
+                }
+            }
+        }
+        if(!parabolic) {
+            e = (x < m ? b : a) - x;
+            d = golden * e;
+        }
+        const double u = x + (fabs(d) >= tol ? d : (d > 0 ? tol : -tol));
+        const double fu = -f(u);
+        if(fu <= fx) {
+            if(u < x) {
+                b = x;
+            } else {
+                a = x;
+            }
+            v = w; fv = fw;
+            w = x; fw = fx;
+            x = u; fx = fu;
+        } else {
+            if(u < x) {
+                a = u;
+            } else {
+                b = u;
+            }
+            if(fu <= fw || w == x) {
+                v = w; fv = fw;
+                w = u; fw = fu;
+            } else if(fu <= fv || v == x || v == w) {
+                v = u; fv = fu;
+            }
+        }
+    }
+    return { x, -fx, 0 };
+}
+
+/**
+ * @brief Passes over minElevation of one satellite in [t0, t1]. A pass in
+ * course at t0 (t1) starts (ends) there.
+ *
+ * @param probe elevation(t) gives the elevation (radians) at a time and
+ * sample(t) also the quiet time, the seconds in which it cannot overfly
+ */
+template<typename Probe>
+void scan(Probe& probe, double t0, double t1, double minElevation, double coarseStep,
+    double tolerance, std::vector<Pass>& out)
+{
+    auto above = [&probe, minElevation](double t) {
+        return probe.elevation(t) - minElevation;
+    };
+    auto elevation = [&probe](double t) {
+        return probe.elevation(t);
+    };
+
+    // the last three samples, the satellite cannot overfly between a quiet
+    // one and the next
+    Sample a = { t0, -pi, 0 }; // none before t0
+    Sample b = probe.sample(t0);
+    bool inPass = b.elevation >= minElevation;
+    bool ended = false; // a pass ended between b and c
+    Pass pass = { t0, t1, t0, b.elevation };
+
+    // local maximum of the samples, searched only where it can overfly
+    auto peak = [&](const Sample& c) {
+        const double left = a.quietTime > coarseStep ? b.t : a.t;
+        const double right = b.quietTime > coarseStep ? b.t : c.t;
+        if(!(b.elevation > a.elevation && b.elevation >= c.elevation && left < right)) {
+            return;
+        }
+        const Sample top = brentMax(elevation, left, right, tolerance);
+        if(top.elevation < minElevation) {
+            return;
+        }
+        if(inPass || ended) {
+            Pass& current = inPass ? pass : out.back();
+            if(top.elevation > current.maxElevation) {
+                current.culmination = top.t;
+                current.maxElevation = top.elevation;
+            }
+        } else {
+            // a pass between two samples, both under the minimum elevation
+            Pass shortPass;
+            shortPass.aos = brentRoot(above, left, top.t, above(left), top.elevation - minElevation, tolerance);
+            shortPass.los = brentRoot(above, top.t, right, top.elevation - minElevation, above(right), tolerance);
+            shortPass.culmination = top.t;
+            shortPass.maxElevation = top.elevation;
+            out.push_back(shortPass);
+        }
+    };
+
+    while(b.t < t1) {
+        const Sample c = probe.sample(std::min(b.t + std::min(std::max(coarseStep, b.quietTime), maxStep), t1));
+
+        ended = false;
+        if(!inPass && c.elevation >= minElevation) {
+            pass.aos = brentRoot(above, b.t, c.t, b.elevation - minElevation, c.elevation - minElevation, tolerance);
+            pass.culmination = c.t;
+            pass.maxElevation = c.elevation;
+            inPass = true;
+        } else if(inPass && c.elevation < minElevation) {
+            pass.los = brentRoot(above, b.t, c.t, b.elevation - minElevation, c.elevation - minElevation, tolerance);
+            out.push_back(pass);
+            inPass = false;
+            ended = true;
+        }
+        if(inPass && c.elevation > pass.maxElevation) {
+            pass.culmination = c.t;
+            pass.maxElevation = c.elevation;
+        }
+        peak(c);
+
+        a = b;
+        b = c;
+    }
+    // none after t1, as before t0
+    ended = false;
+    peak({ t1, -pi, 0 });
+    if(inPass) {
+        pass.los = t1;
+        out.push_back(pass);
+    }
+}
+
+}
@@ -0,0 +1,103 @@
+/**
+ * @file prefetch.cpp
+ * @brief Ring buffer of the frames ahead of the playback, see tickPrefetched().
+ *
+ * The playback is a start time and a step (negative to play backwards). The
+ * frames (same layout as tickFrame()) at start + k * step are computed in
+ * advance by prefetchFrame(), called by the worker while idle up to a depth
+ * that it adapts to the time a frame takes. A tick at a time in the buffer is
+ * then a copy; the frames behind it are dropped, the one served is kept
+ * while it is requested again.
+ */
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+
+namespace prefetch {
+
+const size_t defaultCapacity = 32; // frames
+const double tolerance = 0.002; // seconds, the client rounds the times to ms
+
+struct Ring {
+    size_t capacity = 0; // frames
+    size_t frameFloats = 0;
+    std::vector<float> frames; // capacity * frameFloats
+    std::vector<double> times; // by slot, seconds since J2000
+    size_t head = 0; // slot of the oldest frame
+    size_t count = 0;
+    bool active = false;
+    double next = 0; // time of the next frame to compute
+    double step = 0; // seconds
+    size_t hits = 0;
+    size_t misses = 0;
+    uint32_t mask = 0; // catalog::mask and catalog::revision of the frames
+    uint32_t revision = 0;
+};
+
+Ring ring;
+
+void configure(size_t capacity, size_t frameFloats) {
+    ring.capacity = std::max((size_t) 1, capacity);
+    ring.frameFloats = frameFloats;
+    ring.frames.assign(ring.capacity * frameFloats, 0);
+    ring.times.assign(ring.capacity, 0);
+    ring.head = 0;
+    ring.count = 0;
+}
+
+void start(double time, double step) {
+    ring.head = 0;
+    ring.count = 0;
+    ring.next = time;
+    ring.step = step;
+    ring.active = step != 0;
+    ring.hits = 0;
+    ring.misses = 0;
+}
+
+void stop() {
+    ring.active = false;
+    ring.count = 0;
+}
+
+/**
+ * @brief Drops the frames buffered, which are computed again from the first
+ */
+void flush() {
+    if(ring.count > 0) {
+        ring.next = ring.times[ring.head];
+    }
+    ring.head = 0;
+    ring.count = 0;
+}
+
+bool full(size_t depth) {
+    return ring.count >= std::min(depth, ring.capacity);
+}
+
+void push(double time, const float* frame) {
+    size_t slot = (ring.head + ring.count) % ring.capacity;
+    ring.times[slot] = time;
+    std::copy(frame, frame + ring.frameFloats, ring.frames.data() + slot * ring.frameFloats);
+    ring.count++;
+}
+
+/**
+ * @brief Frame at time, dropping the ones behind it in the playback
+ *
+ * @return const float* nullptr if it is not in the buffer
+ */
+const float* find(double time) {
+    const double direction = ring.step < 0 ? -1 : 1;
+    while(ring.count > 0 && (ring.times[ring.head] - time) * direction < -tolerance) {
+        ring.head = (ring.head + 1) % ring.capacity;
+        ring.count--;
+    }
+    if(ring.count == 0 || fabs(ring.times[ring.head] - time) > tolerance) {
+        return nullptr;
+    }
+    return ring.frames.data() + ring.head * ring.frameFloats;
+}
+
+}
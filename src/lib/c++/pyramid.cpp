@@ -0,0 +1,118 @@
+/**
+ * @file pyramid.cpp
+ * @brief Min/max/mean pyramid of the histogram, built while recording, see
+ * queryHistogram().
+ *
+ * The level 0 has a bucket by histogram item, each bucket of the level L the
+ * two buckets below it, so 2^L items. A push updates the last bucket of each
+ * level, O(levels). A query picks the finest level whose buckets in the time
+ * window fit in the pixels asked, so the plot gets at most ~pixels buckets
+ * whatever the length of the analysis.
+ */
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+
+namespace pyramid {
+
+const int CHANNELS = 3; // overfly, sunlit, visible
+const size_t QUERY_STRIDE = 1 + 3 * CHANNELS; // time, min, max, mean by channel
+
+struct Bucket {
+    double t; // seconds since J2000 of the first item
+    uint32_t count; // items
+    int min[CHANNELS];
+    int max[CHANNELS];
+    double sum[CHANNELS];
+};
+
+std::vector<std::vector<Bucket>> levels;
+std::vector<double> query; // QUERY_STRIDE doubles by bucket of the last query()
+int queryLevel = 0;
+
+void clear() {
+    levels.clear();
+    query.clear();
+}
+
+void merge(Bucket& into, const Bucket& other) {
+    into.count += other.count;
+    for(int c = 0; c < CHANNELS; c++) {
+        into.min[c] = std::min(into.min[c], other.min[c]);
+        into.max[c] = std::max(into.max[c], other.max[c]);
+        into.sum[c] += other.sum[c];
+    }
+}
+
+void push(double t, int overflyCount, int sunlitCount, int visibleCount) {
+    if(levels.empty()) {
+        levels.emplace_back();
+    }
+    Bucket item = { t, 1,
+        { overflyCount, sunlitCount, visibleCount },
+        { overflyCount, sunlitCount, visibleCount },
+        { (double) overflyCount, (double) sunlitCount, (double) visibleCount } };
+    levels[0].push_back(item);
+    // the last bucket of each level from the two below it, up to a level of one
+    for(size_t level = 1; levels[level - 1].size() > 1; level++) {
+        if(levels.size() == level) {
+            levels.emplace_back();
+        }
+        const std::vector<Bucket>& below = levels[level - 1];
+        const size_t j = (below.size() - 1) / 2;
+        Bucket bucket = below[2 * j];
+        if(2 * j + 1 < below.size()) {
+            merge(bucket, below[2 * j + 1]);
+        }
+        if(levels[level].size() == j) {
+            levels[level].push_back(bucket);
+        } else {
+            levels[level][j] = bucket;
+        }
+    }
+}
+
+/**
+ * @brief Fills query with the buckets of [t0, t1] of the finest level with at
+ * most pixels of them, plus the ones before and after to join the plot
+ *
+ * @return size_t number of buckets
+ */
+size_t select(double t0, double t1, int pixels) {
+    query.clear();
+    if(levels.empty() || t1 < t0) {
+        return 0;
+    }
+    const std::vector<Bucket>& items = levels[0];
+    auto byTime = [](const Bucket& bucket, double t) {
+        return bucket.t < t;
+    };
+    // items [first, last) in the window, with the ones around it
+    size_t first = std::lower_bound(items.begin(), items.end(), t0, byTime) - items.begin();
+    size_t last = std::lower_bound(items.begin(), items.end(), t1, byTime) - items.begin();
+    first = first > 0 ? first - 1 : 0;
+    last = std::min(last + 1, items.size());
+    if(first >= last) {
+        return 0;
+    }
+    const size_t n = last - first;
+    const size_t maxBuckets = std::max(1, pixels);
+    size_t level = 0;
+    while((n >> level) > maxBuckets && level + 1 < levels.size()) {
+        level++;
+    }
+    queryLevel = (int) level;
+    const std::vector<Bucket>& buckets = levels[level];
+    for(size_t j = first >> level; j <= (last - 1) >> level && j < buckets.size(); j++) {
+        const Bucket& bucket = buckets[j];
+        query.push_back(bucket.t);
+        for(int c = 0; c < CHANNELS; c++) {
+            query.push_back(bucket.min[c]);
+            query.push_back(bucket.max[c]);
+            query.push_back(bucket.sum[c] / bucket.count);
+        }
+    }
+    return query.size() / QUERY_STRIDE;
+}
+
+}
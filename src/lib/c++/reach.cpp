@@ -0,0 +1,197 @@
+/**
+ * @file reach.cpp
+ * @brief Latitude bands in which each satellite can overfly an observer,
+ * from the geometry of its orbit, see prepareReach().
+ *
+ * A satellite overflies while its central angle to the observer is under the
+ * cap angle of its radius (events::capAngle), which is widest at apogee, and
+ * that central angle is at least the difference of their geocentric
+ * latitudes. The sub-satellite latitude never exceeds the inclination (180
+ * minus it if retrograde), so it can only overfly with the sub-satellite
+ * point in
+ *
+ *   [latitude - cap(apogee), latitude + cap(apogee)] ∩ [-i, i]
+ *
+ * and never if that band is empty: an observer at high latitude and a low
+ * inclination shell, or a high minimum elevation and a low orbit. The bounds
+ * come from the mean elements with the margins of events.cpp; the deep space
+ * orbits (SGP4 method 'd'), whose inclination drifts with the lunisolar
+ * perturbations, are only bounded by their apogee.
+ *
+ * From a position the time before the satellite can overfly is bounded by
+ * quietTime() with three lower bounds, the largest one wins:
+ *
+ *   footprint  events::quietTime(), the central angle to the observer minus
+ *              the cap, at the maximum angular rate.
+ *   period     the argument of latitude u to go until the sub-satellite
+ *              point enters the band (sin(lat) = sin(i) sin(u)), at the
+ *              orbital angular rate at perigee.
+ *   drift      the angle between the observer and the orbital plane minus
+ *              the cap, at the Earth rotation plus the nodal precession.
+ *
+ * The orbital plane is the one of the mean elements (inclo, nodeo +
+ * nodedot t), so the deep space orbits only get the footprint bound.
+ */
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include "transforms.hpp"
+
+namespace reach {
+
+struct Band {
+    bool possible; // can overfly the observer at some time
+    double latitudeMin; // radians, geocentric latitude of the sub-satellite point
+    double latitudeMax;
+    double cap; // radians, widest cap angle plus the margin
+};
+
+// observer of a prepare()
+struct Site {
+    EcfV3 ecf;
+    double ro; // km from the Earth center
+    double latitude; // radians, geocentric
+    double minElevation; // radians
+};
+
+// bands for one observer: the one of prepareReach(), of the analysis job
+// (job::Job::reach) or of a findPasses(), so each keeps its own
+struct State {
+    std::vector<Band> bands; // by satrecs index
+    std::vector<events::Bounds> limits; // by satrecs index
+    Site site;
+    std::vector<float> view; // degrees, latitudeMin, latitudeMax by satellite, NaN if impossible
+    size_t possibleCount = 0;
+};
+
+State shared; // of prepareReach(), see getReachBands()
+
+/**
+ * @param latitude geocentric latitude of the observer, radians
+ * @param ro geocentric radius of the observer, km
+ * @param minElevation radians
+ */
+Band band(const elsetrec& satrec, double latitude, double ro, double minElevation) {
+    const events::Bounds b = events::bounds(satrec);
+    const double cap = events::capAngle(b.apogee, ro, minElevation) + events::angleMargin;
+    double maxLatitude = pi / 2;
+    if(satrec.method != 'd') {
+        const double inclination = satrec.inclo <= pi / 2 ? satrec.inclo : pi - satrec.inclo;
+        maxLatitude = std::min(pi / 2, inclination + events::angleMargin);
+    }
+    Band result;
+    result.cap = cap;
+    result.latitudeMin = std::max(latitude - cap, -maxLatitude);
+    result.latitudeMax = std::min(latitude + cap, maxLatitude);
+    result.possible = result.latitudeMin <= result.latitudeMax;
+    return result;
+}
+
+/**
+ * @brief Bands of every satellite for the observer of frame, into state
+ *
+ * @return size_t number of satellites that can overfly
+ */
+size_t prepare(State& state, const std::vector<elsetrec>& satrecs, const ObserverFrame& frame) {
+    std::vector<Band>& bands = state.bands;
+    std::vector<events::Bounds>& limits = state.limits;
+    std::vector<float>& view = state.view;
+    Site& site = state.site;
+    size_t& possibleCount = state.possibleCount;
+    const EcfV3& o = frame.ecf;
+    site.ecf = o;
+    site.ro = sqrt(o.x * o.x + o.y * o.y + o.z * o.z);
+    site.latitude = atan2(o.z, sqrt(o.x * o.x + o.y * o.y));
+    site.minElevation = frame.observer.minElevation * deg2rad;
+    bands.resize(satrecs.size());
+    limits.resize(satrecs.size());
+    view.resize(2 * satrecs.size());
+    possibleCount = 0;
+    for(size_t i = 0; i < satrecs.size(); i++) {
+        bands[i] = band(satrecs[i], site.latitude, site.ro, site.minElevation);
+        limits[i] = events::bounds(satrecs[i]);
+        if(bands[i].possible) {
+            possibleCount++;
+            view[2 * i] = bands[i].latitudeMin * rad2deg;
+            view[2 * i + 1] = bands[i].latitudeMax * rad2deg;
+        } else {
+            view[2 * i] = view[2 * i + 1] = NAN;
+        }
+    }
+    return possibleCount;
+}
+
+inline bool possible(const State& state, size_t satIndex) {
+    return satIndex >= state.bands.size() || state.bands[satIndex].possible;
+}
+
+// forward distance from u to the arc [start, end], radians in [0, 2 pi)
+double arcDistance(double u, double start, double end) {
+    const double twoPi = 2 * pi;
+    double fromStart = fmod(u - start, twoPi);
+    if(fromStart < 0) {
+        fromStart += twoPi;
+    }
+    if(fromStart <= fmod(end - start + twoPi, twoPi)) {
+        return 0;
+    }
+    return twoPi - fromStart;
+}
+
+/**
+ * @brief Seconds from now in which the satellite cannot overfly the observer
+ * of state, 0 if it may be overflying
+ *
+ * @param pos position in ECI (TEME), km
+ * @param gmst radians, of now
+ * @param tsince minutes from the epoch of the TLE
+ */
+double quietTime(const State& state, const elsetrec& satrec, size_t satIndex, const EciV3& pos,
+    double gmst, double tsince)
+{
+    const Band& band = state.bands[satIndex];
+    const events::Bounds& b = state.limits[satIndex];
+    const Site& site = state.site;
+    const double r = sqrt(pos.x * pos.x + pos.y * pos.y + pos.z * pos.z);
+    const double cg = cos(gmst);
+    const double sg = sin(gmst);
+    // observer in ECI, unit vector
+    const double ox = (site.ecf.x * cg - site.ecf.y * sg) / site.ro;
+    const double oy = (site.ecf.x * sg + site.ecf.y * cg) / site.ro;
+    const double oz = site.ecf.z / site.ro;
+    const double cosAngle = (pos.x * ox + pos.y * oy + pos.z * oz) / r;
+    const double angle = acos(std::max(-1.0, std::min(1.0, cosAngle)));
+    const double footprint = events::quietTime(b, angle, false, 0, site.ro, site.minElevation);
+    if(satrec.method == 'd') {
+        return footprint;
+    }
+
+    // mean orbital plane: node N and normal n
+    const double node = satrec.nodeo + satrec.nodedot * tsince;
+    const double si = sin(satrec.inclo);
+    const double ci = cos(satrec.inclo);
+    const double nx = cos(node);
+    const double ny = sin(node);
+    const double normal[3] = { ny * si, -nx * si, ci };
+
+    const double planeAngle = asin(std::min(1.0, fabs(ox * normal[0] + oy * normal[1] + oz * normal[2])));
+    const double driftRate = events::earthRotation + fabs(satrec.nodedot) / 60;
+    const double drift = std::max(0.0, events::safetyFactor * (planeAngle - band.cap) / driftRate);
+
+    double period = 0;
+    if(si > 1e-3) {
+        // u from the node, towards n x N
+        const double ex = -ci * ny;
+        const double ey = ci * nx;
+        const double ez = si;
+        const double u = atan2(pos.x * ex + pos.y * ey + pos.z * ez, pos.x * nx + pos.y * ny);
+        const double low = asin(std::max(-1.0, std::min(1.0, sin(band.latitudeMin) / si)));
+        const double high = asin(std::max(-1.0, std::min(1.0, sin(band.latitudeMax) / si)));
+        const double du = std::min(arcDistance(u, low, high), arcDistance(u, pi - high, pi - low));
+        const double orbitalRate = b.angularRate - events::earthRotation;
+        period = events::safetyFactor * du / orbitalRate;
+    }
+    return std::max(footprint, std::max(drift, period));
+}
+
+}
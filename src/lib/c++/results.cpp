@@ -0,0 +1,358 @@
+/**
+ * @file results.cpp
+ * @brief Cache of finished analyses addressed by the hash of their inputs,
+ * see startAnalysisJob().
+ *
+ * The key hashes (FNV-1a, 64 bits) everything the records depend on: the TLE
+ * text of init(), the groups of each satellite and the mask analyzed, the
+ * observer, the interval, the step, the ephemeris step and the interval of
+ * the shadow timeline (see prepareShadows()). An entry keeps the
+ * records as the job leaves them (satTable, its samples and the histogram),
+ * the pyramid is rebuilt from the histogram. The least recently used entries
+ * are evicted to keep the total under maxBytes.
+ *
+ * The whole cache is serialized to a blob (exportBlob()) that importBlob()
+ * reads back, everything little-endian:
+ *   Header, then by entry, from the least to the most recently used:
+ *   uint64 key, uint32 rows, uint32 samples, uint32 histogram
+ *   rows       int32 transit, satIndex, Time starting, ending, float64
+ *              maxElevation, apexAzimuth, sunlitRatio, uint32 samplesOffset,
+ *              samplesLength [rows]
+ *   samples    Time[samples], then float64[samples] of azimuth, elevation,
+ *              rangeSat, sunlit and eclipseDepth
+ *   histogram  Time + int32 overfly, sunlit, visible [histogram]
+ * with Time as int32 year, mon, day, hr, mi and float64 sec.
+ */
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "transforms.hpp"
+
+namespace results {
+
+const uint32_t MAGIC = 0x43415353; // "SSAC"
+const uint16_t VERSION = 2; // 2: sunlitRatio of the rows filled
+const size_t defaultMaxBytes = 64 * 1024 * 1024;
+
+#pragma pack(push, 1)
+struct Header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t entries;
+};
+#pragma pack(pop)
+
+struct Entry {
+    uint64_t key = 0;
+    std::vector<SatTableRow> satTable; // without id, name nor detailed
+    arena::Columns samples;
+    std::vector<HistogramItem> histogram;
+    size_t bytes = 0;
+    uint64_t lastUse = 0;
+};
+
+struct Cache {
+    size_t maxBytes = defaultMaxBytes;
+    size_t bytes = 0;
+    std::vector<Entry> entries;
+    uint64_t clock = 0;
+    size_t hits = 0;
+    size_t misses = 0;
+};
+
+Cache cache;
+uint64_t catalogHash = 0; // of the TLE text of init()
+std::vector<uint8_t> blob; // of the last exportBlob()
+
+struct Hasher {
+    uint64_t h = 0xcbf29ce484222325ull;
+
+    void add(const void* data, size_t size) {
+        const uint8_t* p = (const uint8_t*) data;
+        for(size_t i = 0; i < size; i++) {
+            h ^= p[i];
+            h *= 0x100000001b3ull;
+        }
+    }
+
+    template<typename T>
+    void add(const T& value) {
+        add(&value, sizeof(T));
+    }
+};
+
+uint64_t hash(const std::string& text) {
+    Hasher hasher;
+    hasher.add(text.data(), text.size());
+    return hasher.h;
+}
+
+size_t entryBytes(size_t rows, size_t samples, size_t items) {
+    return sizeof(Entry)
+        + rows * sizeof(SatTableRow)
+        + samples * (sizeof(Time) + 5 * sizeof(double))
+        + items * sizeof(HistogramItem);
+}
+
+inline bool fits(size_t bytes) {
+    return bytes <= cache.maxBytes;
+}
+
+void clear() {
+    cache.entries.clear();
+    cache.bytes = 0;
+    blob.clear();
+}
+
+// evicts the least recently used entries until bytes more fit
+void evict(size_t bytes) {
+    while(!cache.entries.empty() && cache.bytes + bytes > cache.maxBytes) {
+        auto oldest = std::min_element(cache.entries.begin(), cache.entries.end(),
+            [](const Entry& a, const Entry& b) { return a.lastUse < b.lastUse; });
+        cache.bytes -= oldest->bytes;
+        cache.entries.erase(oldest);
+    }
+}
+
+void configure(size_t maxBytes) {
+    cache.maxBytes = maxBytes;
+    evict(0);
+}
+
+Entry* find(uint64_t key) {
+    for(Entry& entry : cache.entries) {
+        if(entry.key == key) {
+            entry.lastUse = ++cache.clock;
+            cache.hits++;
+            return &entry;
+        }
+    }
+    cache.misses++;
+    return nullptr;
+}
+
+/**
+ * @brief Moves entry into the cache, replacing the one of its key
+ *
+ * @return bool false if it does not fit in maxBytes
+ */
+bool store(Entry&& entry) {
+    for(size_t i = 0; i < cache.entries.size(); i++) {
+        if(cache.entries[i].key == entry.key) {
+            cache.bytes -= cache.entries[i].bytes;
+            cache.entries.erase(cache.entries.begin() + i);
+            break;
+        }
+    }
+    entry.bytes = entryBytes(entry.satTable.size(), entry.samples.time.size(), entry.histogram.size());
+    if(!fits(entry.bytes)) {
+        return false;
+    }
+    evict(entry.bytes);
+    entry.lastUse = ++cache.clock;
+    cache.bytes += entry.bytes;
+    cache.entries.push_back(std::move(entry));
+    return true;
+}
+
+template<typename T>
+void put(std::vector<uint8_t>& out, const T& value) {
+    const size_t at = out.size();
+    out.resize(at + sizeof(T));
+    memcpy(out.data() + at, &value, sizeof(T));
+}
+
+void putTime(std::vector<uint8_t>& out, const Time& time) {
+    put<int32_t>(out, time.year);
+    put<int32_t>(out, time.mon);
+    put<int32_t>(out, time.day);
+    put<int32_t>(out, time.hr);
+    put<int32_t>(out, time.mi);
+    put<double>(out, time.sec);
+}
+
+void putColumn(std::vector<uint8_t>& out, const std::vector<double>& column) {
+    const size_t at = out.size();
+    out.resize(at + column.size() * sizeof(double));
+    if(!column.empty()) {
+        memcpy(out.data() + at, column.data(), column.size() * sizeof(double));
+    }
+}
+
+/**
+ * @brief Serializes the cache into blob
+ *
+ * @return size_t bytes of blob
+ */
+size_t exportBlob() {
+    std::vector<const Entry*> entries;
+    for(const Entry& entry : cache.entries) {
+        entries.push_back(&entry);
+    }
+    std::sort(entries.begin(), entries.end(),
+        [](const Entry* a, const Entry* b) { return a->lastUse < b->lastUse; });
+
+    blob.clear();
+    Header header = { MAGIC, VERSION, 0, (uint32_t) entries.size() };
+    put(blob, header);
+    for(const Entry* entry : entries) {
+        put<uint64_t>(blob, entry->key);
+        put<uint32_t>(blob, entry->satTable.size());
+        put<uint32_t>(blob, entry->samples.time.size());
+        put<uint32_t>(blob, entry->histogram.size());
+        for(const SatTableRow& row : entry->satTable) {
+            put<int32_t>(blob, row.transit);
+            put<int32_t>(blob, row.satIndex);
+            putTime(blob, row.starting);
+            putTime(blob, row.ending);
+            put<double>(blob, row.maxElevation);
+            put<double>(blob, row.apexAzimuth);
+            put<double>(blob, row.sunlitRatio);
+            put<uint32_t>(blob, row.samplesOffset);
+            put<uint32_t>(blob, row.samplesLength);
+        }
+        for(const Time& time : entry->samples.time) {
+            putTime(blob, time);
+        }
+        putColumn(blob, entry->samples.azimuth);
+        putColumn(blob, entry->samples.elevation);
+        putColumn(blob, entry->samples.rangeSat);
+        putColumn(blob, entry->samples.sunlit);
+        putColumn(blob, entry->samples.eclipseDepth);
+        for(const HistogramItem& item : entry->histogram) {
+            putTime(blob, item.time);
+            put<int32_t>(blob, item.overflyCount);
+            put<int32_t>(blob, item.sunlitCount);
+            put<int32_t>(blob, item.visibleCount);
+        }
+    }
+    return blob.size();
+}
+
+// bounds checked reading of a blob
+struct Reader {
+    const uint8_t* data;
+    size_t size;
+    size_t at = 0;
+    bool ok = true;
+
+    template<typename T>
+    T get() {
+        T value = T();
+        if(at + sizeof(T) > size) {
+            ok = false;
+            return value;
+        }
+        memcpy(&value, data + at, sizeof(T));
+        at += sizeof(T);
+        return value;
+    }
+
+    Time getTime() {
+        Time time;
+        time.year = get<int32_t>();
+        time.mon = get<int32_t>();
+        time.day = get<int32_t>();
+        time.hr = get<int32_t>();
+        time.mi = get<int32_t>();
+        time.sec = get<double>();
+        return time;
+    }
+
+    void getColumn(std::vector<double>& column, size_t n) {
+        if(at + n * sizeof(double) > size) {
+            ok = false;
+            return;
+        }
+        column.resize(n);
+        if(n > 0) {
+            memcpy(column.data(), data + at, n * sizeof(double));
+        }
+        at += n * sizeof(double);
+    }
+
+    // n items of itemBytes each fit in the rest
+    bool fits(size_t n, size_t itemBytes) {
+        ok = ok && n <= (size - at) / itemBytes;
+        return ok;
+    }
+};
+
+const size_t TIME_BYTES = 5 * 4 + 8;
+const size_t ROW_BYTES = 2 * 4 + 2 * TIME_BYTES + 3 * 8 + 2 * 4;
+
+/**
+ * @brief Adds the entries of a blob of exportBlob() to the cache, as the most
+ * recently used ones. Nothing is added if the blob is not valid.
+ *
+ * @return int entries added, -1 if the blob is not valid
+ */
+int importBlob(const uint8_t* data, size_t size) {
+    Reader reader = { data, size };
+    const Header header = reader.get<Header>();
+    if(!reader.ok || header.magic != MAGIC || header.version != VERSION) {
+        return -1;
+    }
+    std::vector<Entry> entries;
+    for(uint32_t e = 0; e < header.entries && reader.ok; e++) {
+        Entry entry;
+        entry.key = reader.get<uint64_t>();
+        const uint32_t rows = reader.get<uint32_t>();
+        const uint32_t samples = reader.get<uint32_t>();
+        const uint32_t items = reader.get<uint32_t>();
+        if(!reader.fits(rows, ROW_BYTES)) {
+            break;
+        }
+        entry.satTable.resize(rows);
+        for(SatTableRow& row : entry.satTable) {
+            row.transit = reader.get<int32_t>();
+            row.satIndex = reader.get<int32_t>();
+            row.starting = reader.getTime();
+            row.ending = reader.getTime();
+            row.maxElevation = reader.get<double>();
+            row.apexAzimuth = reader.get<double>();
+            row.sunlitRatio = reader.get<double>();
+            row.samplesOffset = reader.get<uint32_t>();
+            row.samplesLength = reader.get<uint32_t>();
+            // without the sum, which wraps in 32 bits
+            reader.ok = reader.ok && row.samplesLength <= samples
+                && row.samplesOffset <= samples - row.samplesLength;
+        }
+        if(!reader.fits(samples, TIME_BYTES + 5 * 8)) {
+            break;
+        }
+        entry.samples.time.resize(samples);
+        for(Time& time : entry.samples.time) {
+            time = reader.getTime();
+        }
+        reader.getColumn(entry.samples.azimuth, samples);
+        reader.getColumn(entry.samples.elevation, samples);
+        reader.getColumn(entry.samples.rangeSat, samples);
+        reader.getColumn(entry.samples.sunlit, samples);
+        reader.getColumn(entry.samples.eclipseDepth, samples);
+        if(!reader.fits(items, TIME_BYTES + 3 * 4)) {
+            break;
+        }
+        entry.histogram.resize(items);
+        for(HistogramItem& item : entry.histogram) {
+            item.time = reader.getTime();
+            item.overflyCount = reader.get<int32_t>();
+            item.sunlitCount = reader.get<int32_t>();
+            item.visibleCount = reader.get<int32_t>();
+        }
+        entries.push_back(std::move(entry));
+    }
+    if(!reader.ok || reader.at != size) {
+        return -1;
+    }
+    int added = 0;
+    for(Entry& entry : entries) {
+        added += store(std::move(entry)) ? 1 : 0;
+    }
+    return added;
+}
+
+}
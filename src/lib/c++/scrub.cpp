@@ -0,0 +1,147 @@
+/**
+ * @file scrub.cpp
+ * @brief Ring cache of tick frames for scrubbing back and forth in time, see
+ * tickScrub().
+ *
+ * The frames (same layout as tickFrame()) are cached at the times multiple of
+ * a quantum, counted from J2000. A request between two cached frames is served by interpolating
+ * them: linearly in latitude, height and the sun position, through the
+ * shortest arc in longitude, and the status and the errors of the nearest
+ * one. The frames are kept in a fixed block of memory and the oldest one is
+ * replaced when it is full.
+ *
+ * With the default 10 s quantum the interpolation error of a LEO satellite is
+ * under 0.2 km (up to ~2 km near the poles, where the latitude and longitude
+ * are far from linear), and the status can be off by up to half a quantum
+ * around a transition.
+ */
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace scrub {
+
+const double defaultQuantum = 10; // seconds
+const size_t defaultMaxBytes = 16 * 1024 * 1024;
+
+struct Cache {
+    double quantum = defaultQuantum;
+    size_t maxBytes = defaultMaxBytes;
+    size_t frameFloats = 0;
+    size_t capacity = 0; // frames
+    std::vector<float> frames; // capacity * frameFloats
+    std::vector<int64_t> keys; // by slot
+    std::unordered_map<int64_t, size_t> slots; // by key
+    size_t next = 0; // slot replaced by the next store()
+    size_t hits = 0;
+    size_t misses = 0;
+    uint32_t mask = 0; // catalog::mask and catalog::revision of the frames
+    uint32_t revision = 0;
+};
+
+Cache cache;
+
+void clear() {
+    cache.slots.clear();
+    cache.next = 0;
+    cache.hits = 0;
+    cache.misses = 0;
+}
+
+/**
+ * @param frameFloats size of a frame, header included
+ * @return size_t number of frames that fit in maxBytes (at least 2)
+ */
+size_t configure(double quantum, size_t maxBytes, size_t frameFloats) {
+    clear();
+    cache.quantum = quantum > 0 ? quantum : defaultQuantum;
+    cache.maxBytes = maxBytes;
+    cache.frameFloats = frameFloats;
+    cache.capacity = std::max((size_t) 2, maxBytes / std::max((size_t) 1, frameFloats * sizeof(float)));
+    cache.frames.assign(cache.capacity * frameFloats, 0);
+    cache.keys.assign(cache.capacity, 0);
+    return cache.capacity;
+}
+
+const float* find(int64_t key) {
+    auto it = cache.slots.find(key);
+    if(it == cache.slots.end()) {
+        return nullptr;
+    }
+    return cache.frames.data() + it->second * cache.frameFloats;
+}
+
+/**
+ * @brief Copies frame into the cache, replacing the oldest frame except keep
+ */
+const float* store(int64_t key, const float* frame, const float* keep = nullptr) {
+    size_t slot = cache.next;
+    if(cache.frames.data() + slot * cache.frameFloats == keep) {
+        slot = (slot + 1) % cache.capacity;
+    }
+    cache.next = (slot + 1) % cache.capacity;
+    if(cache.slots.size() == cache.capacity) {
+        cache.slots.erase(cache.keys[slot]);
+    }
+    cache.keys[slot] = key;
+    cache.slots[key] = slot;
+    float* target = cache.frames.data() + slot * cache.frameFloats;
+    std::copy(frame, frame + cache.frameFloats, target);
+    return target;
+}
+
+float lerp(float a, float b, double w) {
+    return a + (b - a) * w;
+}
+
+// degrees, through the shortest arc, in [-180, 180]
+float lerpLongitude(float a, float b, double w) {
+    float d = b - a;
+    if(d > 180) {
+        d -= 360;
+    } else if(d < -180) {
+        d += 360;
+    }
+    float longitude = a + d * w;
+    if(longitude > 180) {
+        longitude -= 360;
+    } else if(longitude < -180) {
+        longitude += 360;
+    }
+    return longitude;
+}
+
+/**
+ * @brief Writes into out the sun and the satellites between the frames a and
+ * b, w in [0, 1]. The time of the header is left to the caller.
+ *
+ * @param headerSize floats before the first satellite, the sun lat,lon are
+ * the last two
+ * @param entries floats by satellite: status, latitude, longitude, height
+ */
+void interpolate(const float* a, const float* b, double w, float* out,
+    size_t headerSize, size_t entries, size_t nSats)
+{
+    out[headerSize - 2] = lerp(a[headerSize - 2], b[headerSize - 2], w);
+    out[headerSize - 1] = lerpLongitude(a[headerSize - 1], b[headerSize - 1], w);
+
+    const float* nearest = w < 0.5 ? a : b;
+    for(size_t i = 0; i < nSats; i++) {
+        const size_t k = headerSize + i * entries;
+        out[k] = nearest[k];
+        if(a[k] < 0 || b[k] < 0) {
+            // in error in some of them
+            out[k + 1] = nearest[k + 1];
+            out[k + 2] = nearest[k + 2];
+            out[k + 3] = nearest[k + 3];
+            continue;
+        }
+        out[k + 1] = lerp(a[k + 1], b[k + 1], w);
+        out[k + 2] = lerpLongitude(a[k + 2], b[k + 2], w);
+        out[k + 3] = lerp(a[k + 3], b[k + 3], w);
+    }
+}
+
+}
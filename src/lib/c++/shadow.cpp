@@ -0,0 +1,151 @@
+/**
+ * @file shadow.cpp
+ * @brief Eclipse intervals of each satellite over a time window, shared by
+ * every observer, see prepareShadows().
+ *
+ * The shadow function is the eclipse depth of solar::satEclipsed, eclipsed
+ * while it is >= 0. It is sampled every |depth| / depthRate seconds (its
+ * maximum rate, events::Bounds), at least minStep, and the crossings
+ * bracketed by two samples are refined with Brent's method
+ * (passes::brentRoot) into the shadow entry and exit. Two crossings between
+ * samples, a grazing eclipse shorter than the step, need a maximum over 0
+ * between them: a local maximum of the samples that the rate allows to reach
+ * 0 is refined with passes::brentMax.
+ *
+ * The intervals are kept flat: the bounds of satellite i are
+ * bounds[first[i], first[i + 1]), entry, exit, entry, exit... in seconds since
+ * J2000, an eclipse at t0 enters at t0 and one at t1 exits at INFINITY. A
+ * time is eclipsed if an odd number of bounds are <= it.
+ */
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include "transforms.hpp"
+
+namespace shadow {
+
+const double minStep = 60; // seconds
+const double maxStep = 600; // seconds
+const double tolerance = 1e-3; // seconds
+
+struct Timeline {
+    double t0 = 0; // seconds since J2000
+    double t1 = 0;
+    std::vector<uint32_t> first; // by satellite, plus the end
+    std::vector<double> bounds;
+    std::vector<uint8_t> covered; // by satellite, SGP4 did not fail in [t0, t1]
+};
+
+Timeline timeline;
+size_t propagations = 0; // by the last buildShadows()
+
+void clear() {
+    timeline.t0 = timeline.t1 = 0;
+    timeline.first.clear();
+    timeline.bounds.clear();
+    timeline.covered.clear();
+}
+
+/**
+ * @brief Appends to out the bounds of the eclipses of probe in [t0, t1]
+ *
+ * @param probe with double depth(double t), NAN if SGP4 fails
+ * @param depthRate rad/s, maximum rate of the depth
+ * @return bool false if SGP4 failed
+ */
+template<typename Probe>
+bool scan(Probe& probe, double t0, double t1, double depthRate, std::vector<double>& out) {
+    bool failed = false;
+    auto depth = [&probe, &failed](double t) {
+        const double d = probe.depth(t);
+        failed = failed || std::isnan(d);
+        return d;
+    };
+    // passes::brentMax() keeps the value in Sample::elevation
+    passes::Sample a = { t0, -INFINITY, 0 }; // none before t0
+    passes::Sample b = { t0, depth(t0), 0 };
+    if(b.elevation >= 0) {
+        out.push_back(t0);
+    }
+
+    // two crossings between a and c around a maximum at b under 0
+    auto graze = [&](const passes::Sample& c) {
+        if(!(b.elevation > a.elevation && b.elevation >= c.elevation && b.elevation < 0)
+            || b.elevation + depthRate * std::max(b.t - a.t, c.t - b.t) < 0) {
+            return;
+        }
+        const passes::Sample top = passes::brentMax(depth, a.t, c.t, tolerance);
+        if(top.elevation >= 0) {
+            out.push_back(passes::brentRoot(depth, a.t, top.t, a.elevation, top.elevation, tolerance));
+            out.push_back(passes::brentRoot(depth, top.t, c.t, top.elevation, c.elevation, tolerance));
+        }
+    };
+
+    while(b.t < t1 && !failed) {
+        const double step = std::min(std::max(minStep, fabs(b.elevation) / depthRate), maxStep);
+        const double t = std::min(b.t + step, t1);
+        const passes::Sample c = { t, depth(t), 0 };
+        if(failed) {
+            break;
+        }
+        if((b.elevation >= 0) != (c.elevation >= 0)) {
+            out.push_back(passes::brentRoot(depth, b.t, c.t, b.elevation, c.elevation, tolerance));
+        } else if(a.t < b.t) {
+            graze(c);
+        }
+        a = b;
+        b = c;
+    }
+    if(out.size() % 2 == 1) {
+        out.push_back(INFINITY);
+    }
+    return !failed;
+}
+
+/**
+ * @brief 1 if the satellite is sunlit at t, 0 if eclipsed, -1 if the
+ * timeline does not cover it
+ */
+inline int sunlit(size_t satIndex, double t) {
+    if(satIndex >= timeline.covered.size() || !timeline.covered[satIndex]
+        || t < timeline.t0 || t > timeline.t1) {
+        return -1;
+    }
+    const double* begin = timeline.bounds.data() + timeline.first[satIndex];
+    const double* end = timeline.bounds.data() + timeline.first[satIndex + 1];
+    return (std::upper_bound(begin, end, t) - begin) % 2 == 0;
+}
+
+/**
+ * @brief Fraction of [a, b] out of the eclipses of the bounds [begin, end)
+ */
+double sunlitRatio(const double* begin, const double* end, double a, double b) {
+    if(b <= a) {
+        return (std::upper_bound(begin, end, a) - begin) % 2 == 0 ? 1 : 0;
+    }
+    double eclipsed = 0;
+    for(const double* p = begin; p + 1 < end; p += 2) {
+        eclipsed += std::max(0.0, std::min(b, p[1]) - std::max(a, p[0]));
+    }
+    return 1 - eclipsed / (b - a);
+}
+
+inline bool covers(size_t satIndex, double a, double b) {
+    return satIndex < timeline.covered.size() && timeline.covered[satIndex]
+        && a >= timeline.t0 && b <= timeline.t1;
+}
+
+/**
+ * @brief Fraction of [a, b] in which the satellite is sunlit, NAN if the
+ * timeline does not cover it
+ */
+double sunlitRatio(size_t satIndex, double a, double b) {
+    if(!covers(satIndex, a, b)) {
+        return NAN;
+    }
+    return sunlitRatio(timeline.bounds.data() + timeline.first[satIndex],
+        timeline.bounds.data() + timeline.first[satIndex + 1], a, b);
+}
+
+}
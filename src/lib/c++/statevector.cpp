@@ -0,0 +1,99 @@
+/**
+ * @file statevector.cpp
+ * @brief State vectors that the client can extrapolate, see tickState().
+ *
+ * The acceleration is the two-body one. The validity horizon is the time for
+ * which the truncation error of the extrapolation stays under maxError:
+ *   linear     |a| t^2 / 2 <= maxError
+ *   quadratic  |j| t^3 / 6 <= maxError
+ * where |a| and |j| (jerk) are bounded from the current state, adding the
+ * Coriolis and centrifugal terms in ECF. A safety factor covers the
+ * perturbations ignored here (J2, drag), and the horizon never exceeds
+ * 1/16 of the orbital period.
+ */
+#include <cmath>
+#include <algorithm>
+#include "transforms.hpp"
+
+namespace statevector {
+
+const double earthRotation = 7.292115146706979e-5; // rad/s
+const double safetyFactor = 0.5;
+const double maxPeriodShare = 1.0 / 16.0;
+
+enum Frame {
+    ECI = 0,
+    ECF = 1
+};
+
+struct State {
+    V3 pos;  // km
+    V3 vel;  // km/s
+    V3 acc;  // km/s^2
+    double horizon; // s
+};
+
+double norm(const V3& v) {
+    return sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+}
+
+/**
+ * @param posvel position (km) and velocity (km/s) in ECI, as given by sgp4
+ * @param mus gravitational parameter (km^3/s^2), satrec.mus
+ * @param period orbital period (s)
+ * @param order 1 linear, 2 quadratic
+ * @param maxError km
+ * @param gmst only used for ECF
+ */
+State state(const PosVel& posvel, double mus, double period, int order, double maxError,
+    Frame frame, double gmst)
+{
+    const V3 r = { posvel.pos.x, posvel.pos.y, posvel.pos.z };
+    const V3& v = posvel.vel;
+    const double rNorm = norm(r);
+    const double vNorm = norm(v);
+    const double k = mus / (rNorm * rNorm * rNorm);
+    const double radialSpeed = fabs(r.x * v.x + r.y * v.y + r.z * v.z) / rNorm;
+
+    State s;
+    s.pos = r;
+    s.vel = v;
+    s.acc = { -k * r.x, -k * r.y, -k * r.z };
+
+    double accBound = k * rNorm;
+    double jerkBound = k * (vNorm + 3 * radialSpeed);
+
+    if(frame == ECF) {
+        const double w = earthRotation;
+        const double c = cos(gmst);
+        const double sn = sin(gmst);
+        // same rotation as eciToEcf()
+        V3 rE = { r.x * c + r.y * sn, -r.x * sn + r.y * c, r.z };
+        V3 vR = { v.x * c + v.y * sn, -v.x * sn + v.y * c, v.z };
+        V3 aR = { s.acc.x * c + s.acc.y * sn, -s.acc.x * sn + s.acc.y * c, s.acc.z };
+        // v_ecf = R v - w x r_ecf
+        V3 vE = { vR.x + w * rE.y, vR.y - w * rE.x, vR.z };
+        // a_ecf = R a - 2 w x v_ecf - w x (w x r_ecf)
+        V3 aE = {
+            aR.x + 2 * w * vE.y + w * w * rE.x,
+            aR.y - 2 * w * vE.x + w * w * rE.y,
+            aR.z
+        };
+        s.pos = rE;
+        s.vel = vE;
+        s.acc = aE;
+        accBound = norm(aE);
+        jerkBound += 3 * w * k * rNorm + 3 * w * w * norm(vE) + w * w * w * rNorm;
+    }
+
+    double horizon;
+    if(order <= 1) {
+        horizon = sqrt(2 * maxError / accBound);
+    } else {
+        horizon = cbrt(6 * maxError / jerkBound);
+    }
+    s.horizon = std::min(safetyFactor * horizon, maxPeriodShare * period);
+    return s;
+}
+
+}
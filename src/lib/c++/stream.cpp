@@ -0,0 +1,214 @@
+/**
+ * @file stream.cpp
+ * @brief Quantized binary format of the tick frames, see tickStream().
+ *
+ * A key frame is a Header followed by, for the n satellites of the catalog
+ * selection (see getFrameSelection()):
+ *   uint8 status[n]  STATUS_* or STATUS_ERROR | errcode
+ *   (1 byte of padding if n is odd)
+ *   int16 latitude[n], int16 longitude[n], int16 height[n]
+ * Everything is little-endian. The coordinates are value = q * scale, with the
+ * scales in the header.
+ *
+ * A delta frame (FLAG_DELTA) follows the frame of the previous sequence and
+ * keeps the absolute status, the coordinates are the difference of q against
+ * it, wrapping as int16 (the longitude is continuous across the antimeridian):
+ *   uint8 status[n]
+ *   int8 latitude[n], int8 longitude[n], int8 height[n]
+ *   int16 escaped[]
+ * A difference out of the int8 range is written as DELTA_ESCAPE and its q is
+ * the next one of escaped. A key frame is written instead when it would not be
+ * larger, and at least every KEY_INTERVAL frames so that a decoder that missed
+ * a frame resumes.
+ */
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+namespace stream {
+
+const uint32_t MAGIC = 0x51415353; // "SSAQ"
+const uint16_t VERSION = 2; // 2: int8 deltas, sequence
+
+const uint16_t FLAG_DELTA = 1;
+const int8_t DELTA_ESCAPE = -128;
+const size_t KEY_INTERVAL = 64;
+
+// same meaning as SatTicketStatus
+const uint8_t STATUS_NONE = 0;
+const uint8_t STATUS_OVERFLY = 1;
+const uint8_t STATUS_SUNLIT = 2;
+const uint8_t STATUS_VISIBLE = 3;
+const uint8_t STATUS_ERROR = 0x80;
+
+const float LATITUDE_SCALE = 90.0f / 32767; // degrees, ~300 m
+const float LONGITUDE_SCALE = 180.0f / 32767; // degrees
+const float HEIGHT_SCALE = 8.0f / 32767; // earth radii, ~1.6 km up to ~45000 km
+
+#pragma pack(push, 1)
+struct Header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint32_t nSats;
+    uint16_t year;
+    uint8_t mon; // 0-11
+    uint8_t day;
+    uint8_t hr;
+    uint8_t mi;
+    uint16_t sequence; // wrapping
+    float sec;
+    float sunLat;
+    float sunLon;
+    float latitudeScale;
+    float longitudeScale;
+    float heightScale;
+};
+#pragma pack(pop)
+
+struct Encoder {
+    std::vector<uint8_t> buffer; // sized for a key frame
+    size_t size = 0; // of the last frame
+    // quantized coordinates of the current and the previous frame
+    std::vector<int16_t> current;
+    std::vector<int16_t> previous;
+    std::vector<int8_t> deltas;
+    std::vector<int16_t> escaped;
+    bool hasPrevious = false;
+    uint16_t sequence = 0;
+    size_t sinceKey = 0; // frames since the last key frame
+    size_t nSats = 0;
+    uint32_t selection = 0; // catalog::selectionSerial of the satellites
+};
+
+Encoder encoder;
+
+size_t frameSize(size_t nSats) {
+    return sizeof(Header) + nSats + (nSats & 1) + 3 * nSats * sizeof(int16_t);
+}
+
+size_t deltaFrameSize(size_t nSats, size_t escapes) {
+    return sizeof(Header) + nSats + 3 * nSats + escapes * sizeof(int16_t);
+}
+
+void reset(size_t nSats) {
+    encoder.nSats = nSats;
+    encoder.buffer.assign(frameSize(nSats), 0);
+    encoder.size = 0;
+    encoder.current.assign(3 * nSats, 0);
+    encoder.previous.assign(3 * nSats, 0);
+    encoder.deltas.assign(3 * nSats, 0);
+    encoder.escaped.clear();
+    encoder.escaped.reserve(3 * nSats);
+    encoder.hasPrevious = false;
+    encoder.sequence = 0;
+    encoder.sinceKey = 0;
+}
+
+int16_t quantize(double value, float scale) {
+    double q = round(value / scale);
+    return (int16_t) std::max(-32767.0, std::min(32767.0, q));
+}
+
+uint8_t* statusAt(size_t entry) {
+    return encoder.buffer.data() + sizeof(Header) + entry;
+}
+
+void writeError(size_t entry, int errcode) {
+    *statusAt(entry) = STATUS_ERROR | (uint8_t) errcode;
+    encoder.current[entry * 3] = 0;
+    encoder.current[entry * 3 + 1] = 0;
+    encoder.current[entry * 3 + 2] = 0;
+}
+
+void writeSat(size_t entry, uint8_t status, double latitude, double longitude, double height) {
+    *statusAt(entry) = status;
+    encoder.current[entry * 3] = quantize(latitude, LATITUDE_SCALE);
+    encoder.current[entry * 3 + 1] = quantize(longitude, LONGITUDE_SCALE);
+    encoder.current[entry * 3 + 2] = quantize(height, HEIGHT_SCALE);
+}
+
+// fills deltas and escaped, false if a key frame is not larger
+bool encodeDeltas() {
+    const size_t n = encoder.nSats;
+    encoder.escaped.clear();
+    for(size_t axis = 0; axis < 3; axis++) {
+        for(size_t i = 0; i < n; i++) {
+            const int16_t q = encoder.current[i * 3 + axis];
+            const int16_t d = (int16_t) (uint16_t) (q - encoder.previous[i * 3 + axis]);
+            if(d > DELTA_ESCAPE && d <= 127) {
+                encoder.deltas[axis * n + i] = (int8_t) d;
+            } else {
+                encoder.deltas[axis * n + i] = DELTA_ESCAPE;
+                encoder.escaped.push_back(q);
+            }
+        }
+    }
+    return deltaFrameSize(n, encoder.escaped.size()) < frameSize(n);
+}
+
+/**
+ * @brief Writes the header and the coordinates of the satellites written with
+ * writeSat()/writeError() since the last frame.
+ *
+ * @param delta encode against the previous frame when it is smaller, ignored
+ * for the first one and every KEY_INTERVAL frames
+ * @return size_t the size in bytes of the frame
+ */
+size_t finish(int year, int mon, int day, int hr, int mi, double sec,
+    double sunLat, double sunLon, bool delta)
+{
+    const size_t n = encoder.nSats;
+    delta = delta && encoder.hasPrevious && encoder.sinceKey + 1 < KEY_INTERVAL && encodeDeltas();
+
+    Header header;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.flags = delta ? FLAG_DELTA : 0;
+    header.nSats = n;
+    header.year = year;
+    header.mon = mon - 1;
+    header.day = day;
+    header.hr = hr;
+    header.mi = mi;
+    header.sequence = ++encoder.sequence;
+    header.sec = sec;
+    header.sunLat = sunLat;
+    header.sunLon = sunLon;
+    header.latitudeScale = LATITUDE_SCALE;
+    header.longitudeScale = LONGITUDE_SCALE;
+    header.heightScale = HEIGHT_SCALE;
+    memcpy(encoder.buffer.data(), &header, sizeof(Header));
+
+    if(delta) {
+        uint8_t* cursor = encoder.buffer.data() + sizeof(Header) + n;
+        memcpy(cursor, encoder.deltas.data(), 3 * n);
+        cursor += 3 * n;
+        if(!encoder.escaped.empty()) {
+            memcpy(cursor, encoder.escaped.data(), encoder.escaped.size() * sizeof(int16_t));
+        }
+        encoder.sinceKey++;
+        encoder.size = deltaFrameSize(n, encoder.escaped.size());
+    } else {
+        uint8_t* cursor = encoder.buffer.data() + sizeof(Header) + n;
+        if(n & 1) {
+            *cursor++ = 0;
+        }
+        for(size_t axis = 0; axis < 3; axis++) {
+            for(size_t i = 0; i < n; i++) {
+                memcpy(cursor, &encoder.current[i * 3 + axis], sizeof(int16_t));
+                cursor += sizeof(int16_t);
+            }
+        }
+        encoder.sinceKey = 0;
+        encoder.size = frameSize(n);
+    }
+
+    encoder.current.swap(encoder.previous);
+    encoder.hasPrevious = true;
+    return encoder.size;
+}
+
+}
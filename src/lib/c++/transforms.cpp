@@ -1,5 +1,6 @@
 #include "transforms.hpp"
 #include <cmath>
+#include <algorithm>
 
 EcfV3 geodeticToEcf(Geodetic geodetic) {
 
@@ -150,4 +151,72 @@ LookAngles ecfToLookAngles(Geodetic observerGeodetic, EcfV3 satelliteEcf) {
 
 double radiansToDegrees(double radians) {
   return radians * rad2deg;
+}
+
+ViewCap cameraViewCap(Camera camera) {
+  // Satellites up to this height are culled, the higher ones are always kept
+  const double maxHeight = 2000.0; // km
+  const double rMax = (earthRadius + maxHeight) / earthRadius;
+  const double d = camera.distance;
+  const double halfFov = camera.fov * deg2rad / 2;
+
+  if(d <= 1.0) {
+    return { camera.latitude, camera.longitude, 180, maxHeight };
+  }
+
+  // a satellite at rMax is not hidden by the Earth up to this angle
+  double radius = acos(1.0 / d) + acos(1.0 / rMax);
+
+  // where the border of the view reaches the ground, plus the same margin
+  if(d * sin(halfFov) < 1.0) {
+    double fovRadius = asin(d * sin(halfFov)) - halfFov + acos(1.0 / rMax);
+    radius = std::min(radius, fovRadius);
+  }
+
+  return { camera.latitude, camera.longitude, radiansToDegrees(radius), maxHeight };
+}
+
+ObserverFrame observerFrame(Observer observer) {
+  ObserverFrame frame;
+  frame.observer = observer;
+  frame.ecf = geodeticToEcf(observer);
+  frame.sinLat = sin(observer.latitude);
+  frame.cosLat = cos(observer.latitude);
+  frame.sinLon = sin(observer.longitude);
+  frame.cosLon = cos(observer.longitude);
+  frame.sinMinElevation = sin(observer.minElevation * deg2rad);
+  return frame;
+}
+
+LookAngles frameLookAngles(const ObserverFrame& frame, EcfV3 satelliteEcf) {
+  // same as ecfToLookAngles(frame.observer, satelliteEcf)
+  double rx = satelliteEcf.x - frame.ecf.x;
+  double ry = satelliteEcf.y - frame.ecf.y;
+  double rz = satelliteEcf.z - frame.ecf.z;
+
+  double topS = ((frame.sinLat * frame.cosLon * rx)
+      + (frame.sinLat * frame.sinLon * ry))
+    - (frame.cosLat * rz);
+
+  double topE = (-frame.sinLon * rx)
+    + (frame.cosLon * ry);
+
+  double topZ = (frame.cosLat * frame.cosLon * rx)
+    + (frame.cosLat * frame.sinLon * ry)
+    + (frame.sinLat * rz);
+
+  return topocentricToLookAngles({ topS, topE, topZ });
+}
+
+bool frameAboveMinElevation(const ObserverFrame& frame, EcfV3 satelliteEcf) {
+  // elevation >= minElevation without the asin
+  double rx = satelliteEcf.x - frame.ecf.x;
+  double ry = satelliteEcf.y - frame.ecf.y;
+  double rz = satelliteEcf.z - frame.ecf.z;
+
+  double topZ = (frame.cosLat * frame.cosLon * rx)
+    + (frame.cosLat * frame.sinLon * ry)
+    + (frame.sinLat * rz);
+
+  return topZ >= frame.sinMinElevation * sqrt((rx * rx) + (ry * ry) + (rz * rz));
 }
\ No newline at end of file
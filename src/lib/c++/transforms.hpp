@@ -7,6 +7,7 @@ const char typeinput = 'e'; // doesn't matters, because typerun is 'v'
 const char opsmode = 'i';   // improved
 const int whichconst = 1;   // wgs84
 const double MINUTES_PER_DAY = 1440.0;
+const double J2000 = 2451545.0; // jd, origin of the times in seconds
 
 #define pi 3.14159265358979323846
 
@@ -84,10 +85,12 @@ struct Transit {
 };
 
 struct SatLogItem {
-    std::vector<Transit> transits;
+    std::vector<Transit> transits; // only built by findSatLog(), see arena.cpp
     int _transitIndex = 0;
     double _prevElevation = 0;
     bool _isRising = true;
+    Transit _open; // samples of the transit in course
+    int _maxIndex = 0; // in _open, of the first maximum elevation
 };
 
 struct Observer: Geodetic {
@@ -95,15 +98,31 @@ struct Observer: Geodetic {
     double minElevation;
 };
 
+// Observer with its ECF position and the trigonometry of its local frame
+// precomputed, so the look angles of many satellites are cheaper
+struct ObserverFrame {
+    Observer observer;
+    EcfV3 ecf;
+    double sinLat;
+    double cosLat;
+    double sinLon;
+    double cosLon;
+    double sinMinElevation;
+};
+
 struct SatTableRow {
     std::string id;
+    std::string name;
     int transit;
     Time starting;
     Time ending;
     double maxElevation;
     double apexAzimuth;
-    Transit detailed;
+    Transit detailed; // of the recording, empty until exported, see arena.cpp
     double sunlitRatio;
+    int satIndex; // index in satrecs, the id is built from it on export
+    size_t samplesOffset = 0; // recorded samples in arena::samples
+    size_t samplesLength = 0;
 };
 
 struct ObserveResult {
@@ -127,12 +146,55 @@ struct TickResult : Geodetic {
     bool visible = false; // if overfly, is night and has sun light
 };
 
+// Same codes as SatTicketStatus in options.ts, errors are -errcode
+enum class SatTicketStatus : int {
+    NONE = 0,
+    OVERFLY = 1001,
+    SUNLIT = 1011, // then also is OVERFLY
+    VISIBLE = 1111 // then also is OVERFLY and SUNLIT
+};
+
 struct TickResults {
     std::vector<TickResult> sats;
     double sunLat;
     double sunLon; 
 };
 
+// Camera looking at the Earth center, as the one of Globe.svelte
+struct Camera {
+    double latitude;  // degrees
+    double longitude; // degrees
+    double distance;  // in Earth radii, from the Earth center
+    double fov;       // degrees, the widest angle of the view
+};
+
+// Spherical cap centered at the Earth center, used to cull the satellites
+// whose direction is farther than radius from (latitude, longitude)
+struct ViewCap {
+    double latitude;  // degrees
+    double longitude; // degrees
+    double radius;    // degrees, >= 180 keeps everything
+    double maxHeight; // km, higher satellites are never culled, <= 0 means no limit
+};
+
+// Ranges [min, max] of the mean elements, see elements.cpp. A range from
+// -Infinity to Infinity does not constrain its element
+struct ElementQuery {
+    double inclinationMin;  // degrees
+    double inclinationMax;
+    double altitudeMin;     // km, mean altitude over the equatorial radius
+    double altitudeMax;
+    double eccentricityMin;
+    double eccentricityMax;
+    double raanMin;         // degrees [0, 360), min > max wraps through 0
+    double raanMax;
+    double epochAgeMin;     // days from the epoch of the TLE to `at`
+    double epochAgeMax;
+    double rcsMin;          // m^2, unknown until setRcs()
+    double rcsMax;
+    Time at;
+};
+
 struct HistogramItem {
     Time time;
     int overflyCount = 0;
@@ -140,6 +202,29 @@ struct HistogramItem {
     int visibleCount = 0;
 };
 
+struct AnalysisOptions {
+    double ephemerisStep; // seconds, grid of the solar ephemeris, <= 0 for the default
+    uint32_t groupMask;   // catalog groups analyzed, 0 keeps the current mask
+};
+
+struct AnalysisProgress {
+    int state; // job::State, see job.cpp
+    int done;  // time steps recorded
+    int total;
+    int rows;  // rows completed so far, see getAnalysisRows()
+};
+
+struct PassOptions {
+    double coarseStep; // seconds between the samples that bracket the passes, <= 0 for 60
+    double detailStep; // seconds between the detailed samples, <= 0 for AOS, culmination and LOS only
+    double tolerance;  // seconds of AOS, LOS and culmination, <= 0 for 0.1
+};
+
+struct AnalysisResult {
+    std::vector<SatTableRow> satTable;
+    std::vector<HistogramItem> histogram;
+};
+
 EcfV3 geodeticToEcf(Geodetic geodetic);
 Topocentric topocentric(Geodetic observerGeodetic, V3 satelliteEcf);
 Geodetic eciToGeodetic(EciV3 eci, double gmst);
@@ -148,5 +233,9 @@ Topocentric topocentric(Geodetic observerGeodetic, EcfV3 satelliteEcf);
 LookAngles topocentricToLookAngles(Topocentric tc);
 LookAngles ecfToLookAngles(Geodetic observerGeodetic, EcfV3 satelliteEcf);
 double radiansToDegrees(double radians);
+ViewCap cameraViewCap(Camera camera);
+ObserverFrame observerFrame(Observer observer);
+LookAngles frameLookAngles(const ObserverFrame& frame, EcfV3 satelliteEcf);
+bool frameAboveMinElevation(const ObserverFrame& frame, EcfV3 satelliteEcf);
 
 #endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 import loadWASM from './c++/cpp.mjs';
-import { SGP4States, SatTicketStatus } from './options';
-import type { Observer, SGP4Interface, SGP4Observer } from './orbitalTypes';
+import { SGP4States } from './options';
+import { AnalysisJobState, CatalogGroups, StateFrame } from './orbitalTypes';
+import type { AnalysisProgress, Camera, ElementQuery, HistogramBucket, HistogramItem, Observer, PassOptions, SatTableRow, SGP4Interface, SGP4Observer, Time, Vector } from './orbitalTypes';
 
 const DEBUG = false;
 
@@ -8,6 +9,17 @@ let SGP4 : SGP4Interface;
 let SGP4State: SGP4States = SGP4States.OFF;
 let nSats: number = 0;
 let observer: Observer;
+let frameSelectionSerial = -1; // of the last 'frameSelection' posted
+
+// Playback prefetch, see startPlayback()
+const PREFETCH_CAPACITY = 32; // frames
+let playback: { interval: number, depth: number, frameMs: number, timer: number } | null = null;
+
+// Analysis in chunks, see makeAnalysis()
+const ANALYSIS_CHUNK_MS = 50;
+let analysis: { paused: boolean, timer: number, satTable: any[], histogramPulled: number } | null = null;
+let analysisInterval: [Date, Date] | null = null;
+const J2000_MS = Date.UTC(2000, 0, 1, 12); // origin of the seconds of the C++ side
 
 function SGP4SetState(newState: SGP4States) {
     const oldState = SGP4State;
@@ -31,7 +43,7 @@ self.onmessage = (event) => {
             console.error(err);
         })
     } else if (type === 'tick') {
-        tick(event.data.time);
+        tick(event.data.time, event.data.camera, event.data.lod, event.data.stream, event.data.scrub);
     } else if (event.data.type === 'setTimeMode') {
         /*if(timeMode === 'STOP' && event.data.timeMode !== 'STOP') {
             timeMode = event.data.timeMode
@@ -42,9 +54,56 @@ self.onmessage = (event) => {
     } else if (type === 'startAnalysis') {
         const {observer, interval, deltaTime} = event.data;
         makeAnalysis(observer, interval, deltaTime)
+    } else if (type === 'queryHistogram') {
+        const {interval, pixels} = event.data;
+        queryHistogram(interval || analysisInterval, pixels);
+    } else if (type === 'pauseAnalysis') {
+        pauseAnalysis();
+    } else if (type === 'resumeAnalysis') {
+        resumeAnalysis();
+    } else if (type === 'cancelAnalysis') {
+        cancelAnalysis();
+    } else if (type === 'findPasses') {
+        const {observer, interval, options} = event.data;
+        findPasses(observer, interval, options);
+    } else if (type === 'prepareReach') {
+        prepareReach(event.data.observer);
+    } else if (type === 'prepareShadows') {
+        prepareShadows(event.data.interval);
+    } else if (type === 'setAnalysisThreads') {
+        setAnalysisThreads(event.data.threads);
+    } else if (type === 'setAnalysisCache') {
+        SGP4 && SGP4.setAnalysisCache(event.data.maxBytes);
+    } else if (type === 'exportAnalysisCache') {
+        exportAnalysisCache();
+    } else if (type === 'importAnalysisCache') {
+        importAnalysisCache(event.data.blob);
     } else if(type === 'setObserver') {
         const {observer,} = event.data;
         setObserver(observer);
+    } else if(type === 'setObservers') {
+        const {observers,} = event.data;
+        setObservers(observers);
+    } else if(type === 'startPlayback') {
+        const {time, step, interval} = event.data;
+        startPlayback(time, step, interval);
+    } else if(type === 'stopPlayback') {
+        stopPlayback();
+    } else if(type === 'setScrubCache') {
+        const {quantum, maxBytes} = event.data;
+        SGP4 && SGP4.setScrubCache(quantum, maxBytes);
+    } else if(type === 'tickEvents') {
+        tickEvents(event.data.time);
+    } else if(type === 'tickObservers') {
+        tickObservers(event.data.time);
+    } else if(type === 'setGroupMask') {
+        setGroupMask(event.data.mask);
+    } else if(type === 'selectElements') {
+        const {query, group} = event.data;
+        selectElements(query, group);
+    } else if(type === 'tickState') {
+        const {time, frame, order, maxError} = event.data;
+        tickState(time, frame, order, maxError);
     }
 }
 
@@ -60,22 +119,64 @@ function initFromInput(text:string) : Promise<number> {
         return Promise.reject(-1);
     }
         
-    let tleTxt = '';
-    text.replace(/\r/g, "")
-        .split(/\n(?=[^12])/)
-        .filter((d) => d)
-        .map((tle) => tle.split("\n"))
-        .filter(([name, ..._]) => { //return true
-            return /^(STARLINK|ONEWEB)/.test(name.trim().replace(/^0 /, ""))
-        })
-        .forEach(([_, ...tle]) => {
-            tleTxt += `\n${tle[0]}\n${tle[1]}`;
-        });
-        nSats = SGP4.init(tleTxt.trim());
-        SGP4SetState(SGP4States.INITIATED);
-        return Promise.resolve(nSats);
+    // the names are parsed and grouped by the catalog, see setGroupMask()
+    nSats = SGP4.init(text.replace(/\r/g, ""));
+    SGP4.setGroupMask(CatalogGroups.STARLINK | CatalogGroups.ONEWEB);
+    SGP4SetState(SGP4States.INITIATED);
+    return Promise.resolve(nSats);
 }
 
+/**
+ * Sats whose mean elements are in the ranges of query (unset ranges do not
+ * constrain), nothing is propagated. With a user group (8-31) the selection
+ * becomes that group, see setGroupMask()
+ */
+function selectElements(query: Partial<ElementQuery>, group: number = -1) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    const fullQuery: ElementQuery = {
+        inclinationMin: -Infinity, inclinationMax: Infinity,
+        altitudeMin: -Infinity, altitudeMax: Infinity,
+        eccentricityMin: -Infinity, eccentricityMax: Infinity,
+        raanMin: -Infinity, raanMax: Infinity,
+        epochAgeMin: -Infinity, epochAgeMax: Infinity,
+        rcsMin: -Infinity, rcsMax: Infinity,
+        at: toSGP4Time(new Date()),
+        ...query
+    };
+    const count = SGP4.selectElements(fullQuery, group);
+    postMessage({
+        type: 'elementsSelection',
+        group,
+        count,
+        indices: SGP4.getElementSelection().slice()
+    });
+}
+
+/**
+ * Only the sats in some of the groups of mask (CatalogGroups and user groups
+ * 8-31) are propagated, without a new init
+ */
+function setGroupMask(mask: number) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    const previousMask = SGP4.setGroupMask(mask >>> 0);
+    postMessage({
+        type: 'groupMask',
+        mask: mask >>> 0,
+        previousMask,
+        count: SGP4.countGroup(mask >>> 0)
+    });
+}
+
+/**
+ * Starts the analysis, run in chunks of ANALYSIS_CHUNK_MS so the ticks are
+ * still served. Each chunk posts 'analysisProgress' with its new rows and
+ * histogram items, the end 'analyzingFinished' with all the rows. The
+ * histogram to plot is asked with 'queryHistogram'
+ */
 function makeAnalysis(observer: Observer, interval: [Date, Date], deltaTime:number = 10000 /*10s*/) {
     if (!SGP4) {
         return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
@@ -84,23 +185,143 @@ function makeAnalysis(observer: Observer, interval: [Date, Date], deltaTime:numb
         return SGP4SetState(SGP4States.ERROR_CANNOT_BECAUSE_IN_ANALYZING);
     }
     SGP4SetState(SGP4States.ANALYZING)
-    const theSGP4Observer: SGP4Observer = {
-        longitude: observer.lng,
-        latitude: observer.lat,
-        height: observer.alt,
-        minElevation: observer.elv,
-        defined: true
+    const [fromTime, toTime] = interval;
+    // the time loop runs in C++, no frame is built
+    SGP4.startAnalysisJob(
+        toSGP4Observer(observer),
+        toSGP4Time(fromTime),
+        toSGP4Time(toTime),
+        deltaTime / 1000,
+        { ephemerisStep: 60, groupMask: 0 }
+    );
+    analysis = { paused: false, timer: 0, satTable: [], histogramPulled: 0 };
+    analysisInterval = interval;
+    scheduleAnalysisChunk();
+}
+
+function scheduleAnalysisChunk() {
+    if(analysis && !analysis.paused && !analysis.timer) {
+        analysis.timer = setTimeout(runAnalysisChunk, 0);
+    }
+}
+
+function runAnalysisChunk() {
+    if(!analysis) {
+        return;
+    }
+    analysis.timer = 0;
+    const progress = SGP4.runAnalysisJob(ANALYSIS_CHUNK_MS);
+    // only the rows and the steps completed since the last chunk
+    const rowsVec = SGP4.getAnalysisRows(analysis.satTable.length, progress.rows);
+    const rows = satTableToJs(rowsVec);
+    rowsVec.delete();
+    const histogramVec = SGP4.getAnalysisHistogram(analysis.histogramPulled, progress.done);
+    const histogram: HistogramItem[] = [];
+    for(let i = 0; i < histogramVec.size(); i++) {
+        histogram.push(histogramVec.get(i));
+    }
+    histogramVec.delete();
+    rows.forEach((row) => analysis.satTable.push(row));
+    analysis.histogramPulled += histogram.length;
+    postMessage({
+        type: 'analysisProgress',
+        done: progress.done,
+        total: progress.total,
+        satTable: rows,
+        histogram
+    });
+    if(progress.state === AnalysisJobState.RUNNING) {
+        scheduleAnalysisChunk();
+    } else {
+        finishAnalysis(progress);
+    }
+}
+
+function finishAnalysis(progress: AnalysisProgress) {
+    if(progress.state === AnalysisJobState.DONE) {
+        postMessage({
+            type: 'analyzingFinished',
+            satTable: analysis.satTable,
+            size: analysis.satTable.length
+        });
+    } else {
+        postMessage({
+            type: 'analysisCancelled',
+            done: progress.done,
+            total: progress.total
+        });
+    }
+    analysis = null;
+    SGP4SetState(SGP4States.INITIATED);
+}
+
+function pauseAnalysis() {
+    if(!analysis) {
+        return;
+    }
+    analysis.paused = true;
+    clearTimeout(analysis.timer);
+    analysis.timer = 0;
+}
+
+function resumeAnalysis() {
+    if(!analysis) {
+        return;
+    }
+    analysis.paused = false;
+    scheduleAnalysisChunk();
+}
+
+/**
+ * Stops the analysis, the rows posted so far stay valid
+ */
+function cancelAnalysis() {
+    if(!analysis) {
+        return;
+    }
+    clearTimeout(analysis.timer);
+    finishAnalysis(SGP4.cancelAnalysisJob());
+}
+
+/**
+ * Histogram of the analysis in interval with about pixels buckets, each one
+ * the min, max and mean of the steps it covers
+ */
+function queryHistogram(interval: [Date, Date], pixels: number) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    if (!interval) {
+        return;
     }
-    SGP4.setObserver(theSGP4Observer);
-    SGP4.startRecording();
     const [fromTime, toTime] = interval;
-    let time = fromTime;
-    do {
-        tick(time);
-        time = new Date(+time + deltaTime);
-    } while(time <= toTime);
-    SGP4.endRecording();
-    const satTable = SGP4.getSatTable();
+    const count = SGP4.queryHistogram(toSGP4Time(fromTime), toSGP4Time(toTime), Math.max(1, Math.round(pixels)));
+    const data = SGP4.getHistogramQuery();
+    const buckets: HistogramBucket[] = [];
+    for(let i = 0; i < count; i++) {
+        const k = i * 10;
+        buckets.push({
+            time: new Date(J2000_MS + data[k] * 1000),
+            overflyMin: data[k + 1],
+            overflyMax: data[k + 2],
+            overflyCount: data[k + 3],
+            sunlitMin: data[k + 4],
+            sunlitMax: data[k + 5],
+            sunlitCount: data[k + 6],
+            visibleMin: data[k + 7],
+            visibleMax: data[k + 8],
+            visibleCount: data[k + 9]
+        });
+    }
+    postMessage({
+        type: 'histogramQuery',
+        interval,
+        pixels,
+        buckets
+    });
+}
+
+function satTableToJs(satTable: Vector<SatTableRow>) {
     const satTableSize = satTable.size();
     const satTableJs = [];
     for(let i = 0; i < satTableSize; i++) {
@@ -117,19 +338,260 @@ function makeAnalysis(observer: Observer, interval: [Date, Date], deltaTime:numb
         satTableRow.detailed = satTableDetailedJs;
         satTableJs.push(satTableRow);
     }
-    const histogramVec = SGP4.getHistogram();
-    const histogramSize = histogramVec.size();
-    const histogram = [];
-    for(let i = 0; i < histogramSize; i++) {
-        histogram.push(histogramVec.get(i));
+    return satTableJs;
+}
+
+/**
+ * Passes over the observer in the interval with AOS, LOS and culmination
+ * found to options.tolerance seconds, same rows as the analysis, nothing is
+ * recorded. Much cheaper than an analysis when only the passes are needed
+ */
+function findPasses(observer: Observer, interval: [Date, Date], options: Partial<PassOptions> = {}) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    const [fromTime, toTime] = interval;
+    const satTable = SGP4.findPasses(
+        toSGP4Observer(observer),
+        toSGP4Time(fromTime),
+        toSGP4Time(toTime),
+        { coarseStep: 60, detailStep: 10, tolerance: 0.1, ...options }
+    );
+    postMessage({
+        type: 'passesFound',
+        satTable: satTableToJs(satTable),
+        size: satTable.size()
+    });
+    satTable.delete();
+}
+
+/**
+ * Latitude bands in which each sat can overfly the observer, the ones that
+ * never can are skipped by the analysis
+ */
+function prepareReach(observer: Observer) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    const count = SGP4.prepareReach(toSGP4Observer(observer));
+    postMessage({
+        type: 'reach',
+        count,
+        bands: SGP4.getReachBands().slice()
+    });
+}
+
+/**
+ * Eclipse intervals of every satellite in interval, shared by the analyses of
+ * any observer inside it
+ */
+function prepareShadows(interval: [Date, Date]) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
     }
+    const [fromTime, toTime] = interval;
+    SGP4.prepareEphemeris(toSGP4Time(fromTime), toSGP4Time(toTime), 60);
     postMessage({
-        type: 'analyzingFinished',
-        satTable: satTableJs,
-        histogram: histogram,
-        size: satTableSize
+        type: 'shadows',
+        interval,
+        count: SGP4.prepareShadows(toSGP4Time(fromTime), toSGP4Time(toTime))
     });
-    //satTable.delete(); // not delete because is created once as "static"
+}
+
+/**
+ * Threads of the analysis, 0 for the hardware ones. Stays 1 unless the module
+ * is built with pthreads (see compile.sh), the result is the same anyway.
+ */
+function setAnalysisThreads(threads: number) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    postMessage({
+        type: 'analysisThreads',
+        threads: SGP4.setAnalysisThreads(threads || 0)
+    });
+}
+
+/**
+ * Posts the cache of finished analyses as a blob to persist outside the
+ * worker, importAnalysisCache() takes it back
+ */
+function exportAnalysisCache() {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    SGP4.exportAnalysisCache();
+    const blob = SGP4.getAnalysisCacheBlob().slice();
+    postMessage({
+        type: 'analysisCache',
+        blob
+    }, [blob.buffer]);
+}
+
+function importAnalysisCache(blob: Uint8Array) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    postMessage({
+        type: 'analysisCacheImported',
+        count: SGP4.importAnalysisCache(blob)
+    });
+}
+
+function toSGP4Observer(observer: Observer): SGP4Observer {
+    return {
+        longitude: observer.lng,
+        latitude: observer.lat,
+        height: observer.alt,
+        minElevation: observer.elv,
+        defined: true
+    };
+}
+
+function setObservers(observers: Observer[]) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    const observersVec = new SGP4['vector<Observer>']();
+    observers.forEach((observer) => observersVec.push_back(toSGP4Observer(observer)));
+    SGP4.setObservers(observersVec);
+    observersVec.delete();
+}
+
+/**
+ * Status of every sat for the observer, propagating only the sats with an
+ * event that may be due. changed are the sats whose flags (ObserverFlags)
+ * changed since the previous tickEvents
+ */
+function tickEvents(time: Date) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    const { year, mon, day, hr, mi, sec } = toSGP4Time(time);
+    const counts = SGP4.tickEvents(year, mon, day, hr, mi, sec);
+    postMessage({
+        type: 'eventsTick',
+        counts,
+        changed: SGP4.getEventChanges().slice(),
+        flags: SGP4.getEventFlags().slice()
+    });
+}
+
+/**
+ * Status of every sat for each observer of setObservers() with a single
+ * propagation, the flags of the observer k are in
+ * flags[k * nSats, (k + 1) * nSats) as ObserverFlags
+ */
+function tickObservers(time: Date) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    const { year, mon, day, hr, mi, sec } = toSGP4Time(time);
+    const countsVec = SGP4.tickObservers(year, mon, day, hr, mi, sec);
+    const counts = [];
+    for(let i = 0; i < countsVec.size(); i++) {
+        counts.push(countsVec.get(i));
+    }
+    const flags = SGP4.getObserverFlags().slice();
+    postMessage({
+        type: 'observersTick',
+        counts,
+        flags
+    }, [flags.buffer]);
+}
+
+/**
+ * Posts the state vectors of every sat (Float64Array), with the layout:
+ * 6 UTC* entries + frame + order + nSats * 11
+ * (status, x, y, z, vx, vy, vz, ax, ay, az, horizon) in km, s
+ * so the main thread can extrapolate each sat until time + horizon with an
+ * error under maxError km.
+ */
+function tickState(time: Date, frame: StateFrame = StateFrame.ECF, order: number = 2, maxError: number = 1) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    const { year, mon, day, hr, mi, sec } = toSGP4Time(time);
+    postFrameSelection();
+    SGP4.tickState(year, mon, day, hr, mi, sec, frame, order, maxError);
+    const state = SGP4.getStateBuffer().slice();
+    postMessage({
+        type: 'stateTick',
+        state
+    }, [state.buffer]);
+}
+
+/**
+ * Prefetches while idle the frames of a playback at time, time + step...
+ * (step in ms, negative to play backwards), requested every interval ms.
+ * The ticks at those times are then read from the buffer. The depth of the
+ * buffer grows with the time a frame takes to compute.
+ */
+function startPlayback(time: Date, step: number, interval: number) {
+    if (!SGP4) {
+        return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
+    }
+    stopPlayback();
+    SGP4.startPrefetch(toSGP4Time(time), step / 1000, PREFETCH_CAPACITY);
+    playback = { interval, depth: 2, frameMs: 0, timer: 0 };
+    prefetch();
+}
+
+function stopPlayback() {
+    if(!playback) {
+        return;
+    }
+    clearTimeout(playback.timer);
+    playback = null;
+    SGP4.stopPrefetch();
+}
+
+function prefetch() {
+    if(!playback) {
+        return;
+    }
+    const startAt = performance.now();
+    const stats = SGP4.getPrefetchStats();
+    const before = stats.get(2);
+    stats.delete();
+    const buffered = SGP4.prefetchFrame(playback.depth);
+    if(buffered > before) {
+        const ms = performance.now() - startAt;
+        playback.frameMs = playback.frameMs ? 0.8 * playback.frameMs + 0.2 * ms : ms;
+        // enough frames to cover two computations in the time between ticks
+        playback.depth = Math.min(PREFETCH_CAPACITY,
+            Math.max(2, Math.ceil(2 * playback.frameMs / playback.interval) + 2));
+    }
+    // yield to the tick messages between frames
+    playback.timer = setTimeout(prefetch, buffered < playback.depth ? 0 : playback.interval / 2);
+}
+
+/**
+ * Posts 'frameSelection' with the sat indices of the entries of the frames
+ * when they changed since the last one, that is with the group mask or the
+ * groups, see setGroupMask()
+ */
+function postFrameSelection() {
+    const serial = SGP4.getFrameSelectionSerial();
+    if(serial === frameSelectionSerial) {
+        return;
+    }
+    frameSelectionSerial = serial;
+    postMessage({
+        type: 'frameSelection',
+        indices: SGP4.getFrameSelection().slice()
+    });
+}
+
+function toSGP4Time(time: Date): Time {
+    return {
+        year: time.getUTCFullYear(),
+        mon: time.getUTCMonth() + 1,
+        day: time.getUTCDate(),
+        hr: time.getUTCHours(),
+        mi: time.getUTCMinutes(),
+        sec: time.getUTCSeconds() + (time.getUTCMilliseconds() / 1000)
+    };
 }
 
 function setObserver(observer:Observer) {
@@ -149,66 +611,67 @@ function setObserver(observer:Observer) {
     SGP4.setObserver(theSGP4Observer);
 }
 
-function tick(time: Date) {
+/**
+ * @param camera only the sats seen by the camera are sent, in a 'viewFrame'
+ * with their indices
+ * @param lod level of detail, about 1 / 2^lod of the sats are sent plus the
+ * ones overflying the observer, in a 'viewFrame' too (ignored if there is a
+ * camera)
+ * @param stream send the quantized binary frame of tickStream() instead,
+ * with deltas, to be decoded with TickStreamDecoder (ignores camera and lod)
+ * @param scrub serve the frame from the scrubbing cache of tickScrub(), for
+ * times going back and forth (ignored with a camera or a lod)
+ *
+ * During a playback the whole frame is read from the prefetched ones and the
+ * camera is ignored.
+ */
+function tick(time: Date, camera?: Camera, lod: number = 0, stream: boolean = false, scrub: boolean = false) {
     if (!SGP4) {
         return SGP4SetState(SGP4States.ERROR_NOT_LOADED);
     }
     const _startAt = Date.now();
 
-    const dataArraySize = nSats * 4 /* entries by sat */  + 6 /* UTC* entries */ + 2 /* sun lat,lon */;
-    const dataArray = new Float32Array(dataArraySize);
-    let cursor = 0;
-
-    const UTCFullYear = time.getUTCFullYear();
-    const UTCMonth = time.getUTCMonth();
-    const UTCDate = time.getUTCDate();
-    const UTCHours = time.getUTCHours();
-    const UTCMinutes = time.getUTCMinutes();
-    const UTCSeconds = time.getUTCSeconds() + (time.getUTCMilliseconds() / 1000);
-    dataArray[cursor++] = UTCFullYear;
-    dataArray[cursor++] = UTCMonth;
-    dataArray[cursor++] = UTCDate;
-    dataArray[cursor++] = UTCHours;
-    dataArray[cursor++] = UTCMinutes;
-    dataArray[cursor++] = UTCSeconds;
-
-    let tickResVector = SGP4.tick(UTCFullYear, UTCMonth + 1, UTCDate, UTCHours, UTCMinutes, UTCSeconds);
-
-    dataArray[cursor++] = tickResVector.sunLat;
-    dataArray[cursor++] = tickResVector.sunLon;
-
-    const tickResVectorSize = tickResVector.sats.size();
-    for(let i = 0; i < tickResVectorSize; i++) {
-        const { satnum, latitude, longitude, height, errcode, overfly, sunlit, visible } = tickResVector.sats.get(i);
-        if(errcode === 0) {
-            let satStatus:SatTicketStatus = SatTicketStatus.NONE;
-            if(visible) {
-                satStatus = SatTicketStatus.VISIBLE;
-            } else if(sunlit) {
-                satStatus = SatTicketStatus.SUNLIT;
-            } else if(overfly) {
-                satStatus = SatTicketStatus.OVERFLY;
-            }
-            dataArray[cursor++] = satStatus;
-            dataArray[cursor++] = latitude;
-            dataArray[cursor++] = longitude;
-            dataArray[cursor++] = height;
-        } else {
-            // -1 - mean elements, ecc >= 1.0 or ecc < -0.001 or a < 0.95 er
-            // -2 - mean motion less than 0.0
-            // -3 - pert elements, ecc < 0.0  or  ecc > 1.0
-            // -4 - semi-latus rectum < 0.0
-            // -5 - epoch elements are sub-orbital
-            // -6 - satellite has decayed
-            dataArray[cursor++] = -1 * errcode // error no position
-            dataArray[cursor++] = 0
-            dataArray[cursor++] = 0
-            dataArray[cursor++] = 0
-        }
-    };
-    tickResVector.sats.delete();
+    // The frame is written by C++ directly in the WASM heap with the layout:
+    // 6 UTC* entries + 2 sun lat,lon + nSats * 4 (status, lat, lng, alt)
+    // where status is a SatTicketStatus, or -errcode if the sat has an error.
+    // The sats are the ones of the group mask, posted by postFrameSelection().
+    // With a camera or a lod only some sats are written (without errors), the
+    // frame is then posted as 'viewFrame' with their indices.
+    const { year, mon, day, hr, mi, sec } = toSGP4Time(time);
+    postFrameSelection();
+    if(stream) {
+        SGP4.tickStream(year, mon, day, hr, mi, sec, true);
+        const streamArray = SGP4.getStreamBuffer().slice();
+        postMessage(streamArray.buffer, [streamArray.buffer]);
+        DEBUG && console.log('s', (Date.now() - _startAt)/1000)
+        return;
+    }
+    let culled = false;
+    if(camera && !playback) {
+        SGP4.tickView(year, mon, day, hr, mi, sec, SGP4.cameraViewCap(camera));
+        culled = true;
+    } else if(lod > 0) {
+        SGP4.tickLod(year, mon, day, hr, mi, sec, lod);
+        culled = true;
+    } else if(scrub) {
+        SGP4.tickScrub(year, mon, day, hr, mi, sec);
+    } else if(playback) {
+        SGP4.tickPrefetched(year, mon, day, hr, mi, sec);
+    } else {
+        SGP4.tickFrame(year, mon, day, hr, mi, sec);
+    }
+    const dataArray = SGP4.getFrameBuffer().slice();
 
-    postMessage(dataArray.buffer, [dataArray.buffer]);
+    if(culled) {
+        const indices = SGP4.getViewIndices().slice();
+        postMessage({
+            type: 'viewFrame',
+            frame: dataArray.buffer,
+            indices
+        }, [dataArray.buffer, indices.buffer]);
+    } else {
+        postMessage(dataArray.buffer, [dataArray.buffer]);
+    }
     DEBUG && console.log('s', (Date.now() - _startAt)/1000)
 }
 
@@ -25,6 +25,38 @@ export interface TickResults {
     sunLon: number
 }
 
+export interface Camera {
+    latitude: number,
+    longitude: number,
+    distance: number, // Earth radii from the Earth center
+    fov: number // degrees
+}
+
+export interface ViewCap {
+    latitude: number,
+    longitude: number,
+    radius: number, // degrees
+    maxHeight: number // km
+}
+
+// Ranges [min, max] of the mean elements for selectElements(), -Infinity to
+// Infinity does not constrain the element
+export interface ElementQuery {
+    inclinationMin: number, // degrees
+    inclinationMax: number,
+    altitudeMin: number, // km, mean altitude
+    altitudeMax: number,
+    eccentricityMin: number,
+    eccentricityMax: number,
+    raanMin: number, // degrees, min > max wraps through 0
+    raanMax: number,
+    epochAgeMin: number, // days
+    epochAgeMax: number,
+    rcsMin: number, // m^2, see setRcs()
+    rcsMax: number,
+    at: Time // reference of the epoch age
+}
+
 export interface Vector<T> {
     size(): number;
     get(i: number): T;
@@ -33,6 +65,7 @@ export interface Vector<T> {
 
 export interface SatTableRow {
     id:string,
+    name:string,
     transit:number,
     starting:object,
     ending:object,
@@ -49,12 +82,110 @@ export interface HistogramItem{
     visibleCount:number
 }
 
+// Bucket of queryHistogram(), the counts are the mean of its steps
+export interface HistogramBucket {
+    time: Date, // of its first step
+    overflyCount: number,
+    overflyMin: number,
+    overflyMax: number,
+    sunlitCount: number,
+    sunlitMin: number,
+    sunlitMax: number,
+    visibleCount: number,
+    visibleMin: number,
+    visibleMax: number
+}
+
+export interface AnalysisOptions {
+    ephemerisStep: number, // seconds, grid of the solar ephemeris
+    groupMask: number // CatalogGroups analyzed, 0 keeps the current mask
+}
+
+export interface AnalysisProgress {
+    state: AnalysisJobState,
+    done: number, // time steps recorded
+    total: number,
+    rows: number // rows completed so far, see getAnalysisRows()
+}
+
+export interface PassOptions {
+    coarseStep: number, // seconds between the samples that bracket the passes
+    detailStep: number, // seconds between the detailed samples, 0 for AOS, culmination and LOS only
+    tolerance: number // seconds of AOS, LOS and culmination
+}
+
+export interface AnalysisResult {
+    satTable: Vector<SatTableRow>,
+    histogram: Vector<HistogramItem>
+}
+
 export interface SGP4Interface {
     init(tleTxt: string): number;
     tick(UTCFullYear:number, UTCMonth:number, UTCDate:number, UTCHours:number, UTCMinutes:number, UTCSeconds:number): TickResults;
+    tickFrame(UTCFullYear:number, UTCMonth:number, UTCDate:number, UTCHours:number, UTCMinutes:number, UTCSeconds:number): number;
+    getFrameBuffer(): Float32Array;
+    tickView(UTCFullYear:number, UTCMonth:number, UTCDate:number, UTCHours:number, UTCMinutes:number, UTCSeconds:number, view:ViewCap): number;
+    getViewIndices(): Int32Array;
+    tickLod(UTCFullYear:number, UTCMonth:number, UTCDate:number, UTCHours:number, UTCMinutes:number, UTCSeconds:number, level:number): number;
+    tickStream(UTCFullYear:number, UTCMonth:number, UTCDate:number, UTCHours:number, UTCMinutes:number, UTCSeconds:number, delta:boolean): number;
+    getStreamBuffer(): Uint8Array;
+    tickState(UTCFullYear:number, UTCMonth:number, UTCDate:number, UTCHours:number, UTCMinutes:number, UTCSeconds:number, frame:StateFrame, order:number, maxError:number): number;
+    getStateBuffer(): Float64Array;
+    cameraViewCap(camera:Camera): ViewCap;
+    setObservers(observers:Vector<SGP4Observer>): number;
+    tickObservers(UTCFullYear:number, UTCMonth:number, UTCDate:number, UTCHours:number, UTCMinutes:number, UTCSeconds:number): Vector<HistogramItem>;
+    getObserverFlags(): Uint8Array;
+    setScrubCache(quantumSeconds:number, maxBytes:number): number;
+    tickScrub(UTCFullYear:number, UTCMonth:number, UTCDate:number, UTCHours:number, UTCMinutes:number, UTCSeconds:number): number;
+    getScrubStats(): Vector<number>; // hits, misses, cached frames
+    startPrefetch(from:Time, stepSeconds:number, capacity:number): void;
+    stopPrefetch(): void;
+    prefetchFrame(depth:number): number;
+    tickPrefetched(UTCFullYear:number, UTCMonth:number, UTCDate:number, UTCHours:number, UTCMinutes:number, UTCSeconds:number): number;
+    getPrefetchStats(): Vector<number>; // hits, misses, buffered frames
+    tickEvents(UTCFullYear:number, UTCMonth:number, UTCDate:number, UTCHours:number, UTCMinutes:number, UTCSeconds:number): HistogramItem;
+    getEventFlags(): Uint8Array;
+    getEventChanges(): Int32Array;
+    getEventPropagations(): number;
+    setGroupMask(mask:number): number;
+    getGroupMask(): number;
+    tagGroup(group:number, prefix:string): number;
+    untagGroup(group:number): void;
+    countGroup(mask:number): number;
+    getSatNames(): Vector<string>;
+    selectElements(query:ElementQuery, group:number): number;
+    getElementSelection(): Int32Array;
+    getFrameSelectionSerial(): number;
+    getFrameSelection(): Int32Array;
+    setRcs(rcs:Vector<number>): number;
+    'vector<double>': new () => Vector<number> & { push_back(value:number): void };
+    'vector<Observer>': new () => Vector<SGP4Observer> & { push_back(observer:SGP4Observer): void };
     startRecording():boolean;
     endRecording():void;
     setObserver(observer:SGP4Observer):boolean;
+    prepareEphemeris(from:Time, to:Time, stepSeconds:number):number;
+    analyze(observer:SGP4Observer, from:Time, to:Time, stepSeconds:number, options:AnalysisOptions): AnalysisResult;
+    startAnalysisJob(observer:SGP4Observer, from:Time, to:Time, stepSeconds:number, options:AnalysisOptions): AnalysisProgress;
+    runAnalysisJob(budgetMs:number): AnalysisProgress;
+    cancelAnalysisJob(): AnalysisProgress;
+    getAnalysisProgress(): AnalysisProgress;
+    setAnalysisThreads(threads:number): number;
+    setAnalysisCache(maxBytes:number): number;
+    clearAnalysisCache(): void;
+    getAnalysisCacheStats(): Vector<number>; // hits, misses, analyses cached, bytes
+    exportAnalysisCache(): number;
+    getAnalysisCacheBlob(): Uint8Array; // valid until the next exportAnalysisCache()
+    importAnalysisCache(blob:Uint8Array): number; // -1 if not valid
+    getAnalysisRows(from:number, count:number): Vector<SatTableRow>;
+    getAnalysisHistogram(from:number, count:number): Vector<HistogramItem>;
+    queryHistogram(from:Time, to:Time, pixels:number): number;
+    getHistogramQuery(): Float64Array; // time, min, max, mean of overfly, sunlit, visible by bucket
+    findPasses(observer:SGP4Observer, from:Time, to:Time, options:PassOptions): Vector<SatTableRow>;
+    prepareReach(observer:SGP4Observer): number;
+    getReachBands(): Float32Array; // min, max latitude (degrees) by sat, NaN if it cannot overfly
+    prepareShadows(from:Time, to:Time): number;
+    getShadowBounds(): Float64Array; // entry, exit of each eclipse, seconds since J2000
+    getShadowFirst(): Uint32Array; // first bound by sat, plus the end
     getSatTable(): Vector<SatTableRow>;
     getHistogram(): Vector<HistogramItem>;
 }
@@ -67,6 +198,38 @@ export interface Observer {
     elv: number // degrees (90 is zenith)
 }
 
+// Frames of tickState()
+export enum StateFrame {
+    ECI = 0,
+    ECF = 1
+}
+
+// States of the analysis job, see startAnalysisJob()
+export enum AnalysisJobState {
+    IDLE = 0,
+    RUNNING = 1,
+    DONE = 2,
+    CANCELLED = 3
+}
+
+// Groups of setGroupMask(), the bits 8-31 are the user groups of tagGroup()
+export enum CatalogGroups {
+    STARLINK = 1 << 0,
+    ONEWEB = 1 << 1,
+    IRIDIUM = 1 << 2,
+    GLOBALSTAR = 1 << 3,
+    ORBCOMM = 1 << 4,
+    KUIPER = 1 << 5,
+    OTHER = 1 << 7
+}
+
+// Flags of getObserverFlags() and getEventFlags()
+export enum ObserverFlags {
+    OVERFLY = 1,
+    SUNLIT = 2,
+    VISIBLE = 4
+}
+
 export interface SGP4Observer {
     longitude: number,
     latitude: number,
@@ -1,4 +1,5 @@
 import type { Time } from './orbitalTypes';
+import { SatTicketStatus } from './options';
 
 export function cppTimeToJsDate(time:Time):Date {
     const date = new Date(0);
@@ -12,4 +13,94 @@ export function cppTimeToJsDate(time:Time):Date {
     date.setUTCSeconds(intUTCSeconds);
     date.setUTCMilliseconds(Math.floor( (time.sec - intUTCSeconds) * 1000 ) );
     return date;
-}
\ No newline at end of file
+}
+// Binary tick frames of tickStream(), see c++/stream.cpp
+export const TICK_STREAM_MAGIC = 0x51415353;
+const TICK_STREAM_HEADER_SIZE = 44;
+const TICK_STREAM_FLAG_DELTA = 1;
+const TICK_STREAM_DELTA_ESCAPE = -128;
+const TICK_STREAM_STATUS = [
+    SatTicketStatus.NONE,
+    SatTicketStatus.OVERFLY,
+    SatTicketStatus.SUNLIT,
+    SatTicketStatus.VISIBLE
+];
+
+export function isTickStream(buffer: ArrayBuffer): boolean {
+    return buffer.byteLength >= TICK_STREAM_HEADER_SIZE &&
+        new DataView(buffer).getUint32(0, true) === TICK_STREAM_MAGIC;
+}
+
+/**
+ * Decodes the frames of tickStream() into the Float32Array layout of
+ * tickFrame(). Keeps the previous frame to decode the delta frames, so the
+ * frames must be decoded in the same order they were encoded. A delta frame
+ * that does not follow the last decoded one throws, decoding resumes with the
+ * next key frame.
+ */
+export class TickStreamDecoder {
+    private previous = new Int16Array(0);
+    private sequence = -1;
+
+    decode(buffer: ArrayBuffer): Float32Array {
+        const header = new DataView(buffer, 0, TICK_STREAM_HEADER_SIZE);
+        const version = header.getUint16(4, true);
+        if(version !== 2) {
+            throw new Error(`Unknown tick stream version ${version}`);
+        }
+        const flags = header.getUint16(6, true);
+        const nSats = header.getUint32(8, true);
+        const sequence = header.getUint16(18, true);
+        const scales = [
+            header.getFloat32(32, true), // latitude
+            header.getFloat32(36, true), // longitude
+            header.getFloat32(40, true)  // height
+        ];
+
+        const status = new Uint8Array(buffer, TICK_STREAM_HEADER_SIZE, nSats);
+        let coords: Int16Array;
+        if(flags & TICK_STREAM_FLAG_DELTA) {
+            if(this.previous.length !== 3 * nSats || sequence !== ((this.sequence + 1) & 0xffff)) {
+                throw new Error('Tick stream delta frame without its previous frame');
+            }
+            const deltas = new Int8Array(buffer, TICK_STREAM_HEADER_SIZE + nSats, 3 * nSats);
+            const escaped = new Int16Array(buffer, TICK_STREAM_HEADER_SIZE + 4 * nSats);
+            coords = new Int16Array(3 * nSats);
+            let e = 0;
+            for(let i = 0; i < coords.length; i++) {
+                coords[i] = deltas[i] === TICK_STREAM_DELTA_ESCAPE
+                    ? escaped[e++]
+                    : (this.previous[i] + deltas[i]) << 16 >> 16;
+            }
+        } else {
+            coords = new Int16Array(buffer, TICK_STREAM_HEADER_SIZE + nSats + (nSats & 1), 3 * nSats).slice();
+        }
+        this.previous = coords;
+        this.sequence = sequence;
+
+        const frame = new Float32Array(6 /* UTC* entries */ + 2 /* sun lat,lon */ + nSats * 4);
+        let cursor = 0;
+        frame[cursor++] = header.getUint16(12, true);
+        frame[cursor++] = header.getUint8(14);
+        frame[cursor++] = header.getUint8(15);
+        frame[cursor++] = header.getUint8(16);
+        frame[cursor++] = header.getUint8(17);
+        frame[cursor++] = header.getFloat32(20, true);
+        frame[cursor++] = header.getFloat32(24, true);
+        frame[cursor++] = header.getFloat32(28, true);
+        for(let i = 0; i < nSats; i++) {
+            if(status[i] & 0x80) {
+                frame[cursor++] = -(status[i] & 0x7f);
+                frame[cursor++] = 0;
+                frame[cursor++] = 0;
+                frame[cursor++] = 0;
+                continue;
+            }
+            frame[cursor++] = TICK_STREAM_STATUS[status[i]];
+            frame[cursor++] = coords[i] * scales[0];
+            frame[cursor++] = coords[nSats + i] * scales[1];
+            frame[cursor++] = coords[2 * nSats + i] * scales[2];
+        }
+        return frame;
+    }
+}